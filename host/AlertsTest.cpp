@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <esp_log.h>
+
+#include "Alerts.h"
+
+#define TAG "AlertsTest"
+
+#define TEST_START 1697580000LL // 2023-10-18, seconds
+
+static int g_failed;
+
+#define CHECK(cond, format, ...)                                               \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            g_failed++;                                                        \
+            ESP_LOGE(TAG, "%s:%d " format, __func__, __LINE__, ##__VA_ARGS__); \
+        }                                                                      \
+    } while (0)
+
+// a three phase inverter at noon, no rule of the defaults is near a threshold
+static SolarEdge_t Normal(void)
+{
+    SolarEdge_t se = {};
+
+    se.C_SunSpec_Phase = 103;
+    se.I_AC_CurrentA = se.I_AC_CurrentB = se.I_AC_CurrentC = 5;
+    se.I_AC_VoltageAN = se.I_AC_VoltageBN = se.I_AC_VoltageCN = 230;
+    se.I_AC_Frequency = 50;
+    se.I_Temp_Sink = 40;
+    se.I_Status = 4;
+
+    return se;
+}
+
+//
+// the sample se every second from 'from' up to 'to' (seconds since TEST_START), returns the number of events.
+// The first event is stored in first, with the second it was raised in at.
+//
+static uint8_t Run(AlertEngine *engine, SolarEdge_t se, uint32_t from, uint32_t to, AlertEvent_t *first = nullptr, uint32_t *at = nullptr)
+{
+    AlertEvent_t events[ALERTS_MAX_RULES];
+    uint8_t total = 0;
+
+    for (uint32_t t = from; t != to; t++)
+    {
+        se.Timestamp = (TEST_START + t) * 1000000LL;
+
+        uint8_t n = engine->Evaluate(&se, events, ALERTS_MAX_RULES);
+        if (n && total == 0 && first)
+        {
+            *first = events[0];
+            if (at)
+                *at = t;
+        }
+        total += n;
+    }
+
+    return total;
+}
+
+// an active alert holds until the clear threshold is passed, not at the set threshold
+static void TestHysteresis(void)
+{
+    static const AlertRule_t rule = { "over_temperature", CH_I_Temp_Sink, ALERT_ABOVE, 75, 70, 0 };
+    AlertEngine engine;
+    AlertEvent_t event;
+    SolarEdge_t se = Normal();
+
+    CHECK(engine.Compile(&rule, 1) == ESP_OK, "Compile");
+
+    se.I_Temp_Sink = 75;
+    CHECK(Run(&engine, se, 0, 5) == 0, "raised at the threshold");
+
+    se.I_Temp_Sink = 76;
+    CHECK(Run(&engine, se, 5, 10, &event) == 1 && event.Active && event.Value == 76 && strcmp(event.Name, "over_temperature") == 0, "not raised above");
+    CHECK(engine.IsActive(0), "not active");
+
+    se.I_Temp_Sink = 72;
+    CHECK(Run(&engine, se, 10, 20) == 0 && engine.IsActive(0), "cleared between the thresholds");
+
+    se.I_Temp_Sink = 70;
+    CHECK(Run(&engine, se, 20, 25) == 0, "cleared at the clear threshold");
+
+    se.I_Temp_Sink = 69;
+    CHECK(Run(&engine, se, 25, 30, &event) == 1 && !event.Active, "not cleared below");
+
+    se.I_Temp_Sink = 74;
+    CHECK(Run(&engine, se, 30, 35) == 0 && !engine.IsActive(0), "raised again between the thresholds");
+}
+
+// the condition must hold for MinDuration, a change that reverts before starts over
+static void TestDebounce(void)
+{
+    static const AlertRule_t rule = { "under_frequency", CH_I_AC_Frequency, ALERT_BELOW, 49.8f, 49.9f, 10 };
+    AlertEngine engine;
+    AlertEvent_t event;
+    SolarEdge_t low = Normal();
+    uint32_t at = 0;
+
+    CHECK(engine.Compile(&rule, 1) == ESP_OK, "Compile");
+    low.I_AC_Frequency = 49.7f;
+
+    // 6 s low, 1 s normal: no alert
+    CHECK(Run(&engine, low, 0, 6) == 0, "raised before the minimum duration");
+    CHECK(Run(&engine, Normal(), 6, 7) == 0, "raised by a normal sample");
+
+    // low from 7 s on: raised at 17 s, 10 s after the change started
+    CHECK(Run(&engine, low, 7, 30, &event, &at) == 1 && event.Active && at == 17, "raised at %u s, expected 17 s", (unsigned)at);
+    CHECK(event.Timestamp == (TEST_START + 17) * 1000000LL, "timestamp of the event");
+
+    // clearing is debounced as well
+    CHECK(Run(&engine, Normal(), 30, 35) == 0 && Run(&engine, low, 35, 36) == 0, "cleared before the minimum duration");
+    CHECK(Run(&engine, Normal(), 36, 60, &event, &at) == 1 && !event.Active && at == 46, "cleared at %u s, expected 46 s", (unsigned)at);
+}
+
+// single and split phase inverters read 0 on the missing phases, the rules on those phases are skipped
+static void TestPhases(void)
+{
+    AlertEngine engine;
+    AlertEvent_t event;
+    SolarEdge_t se = Normal();
+
+    CHECK(engine.Compile(AlertDefaultRules, AlertNumDefaultRules) == ESP_OK, "Compile");
+
+    se.C_SunSpec_Phase = 101;
+    se.I_AC_CurrentB = se.I_AC_CurrentC = 0;
+    se.I_AC_VoltageBN = se.I_AC_VoltageCN = 0;
+    CHECK(Run(&engine, se, 0, 120) == 0, "alerts on a single phase inverter");
+
+    se.C_SunSpec_Phase = 102;
+    se.I_AC_CurrentB = 5;
+    se.I_AC_VoltageBN = 230;
+    CHECK(Run(&engine, se, 120, 240) == 0, "alerts on a split phase inverter");
+
+    // a three phase inverter with a phase at 0 V: raised after 10 s
+    se.C_SunSpec_Phase = 103;
+    se.I_AC_CurrentC = 5;
+    CHECK(Run(&engine, se, 240, 300, &event) == 1 && event.Active && strcmp(event.Name, "under_voltage_c") == 0, "under_voltage_c not raised");
+}
+
+// the imbalance of the phase currents needs IMBALANCE_MIN_CURRENT on average
+static void TestImbalance(void)
+{
+    AlertEngine engine;
+    AlertEvent_t event;
+    SolarEdge_t se = Normal();
+    uint32_t at = 0;
+
+    CHECK(engine.Compile(AlertDefaultRules, AlertNumDefaultRules) == ESP_OK, "Compile");
+
+    // dawn: 0.6 A and twice 0.1 A is 188%, but less than 1 A on average
+    se.I_AC_CurrentA = 0.6f;
+    se.I_AC_CurrentB = se.I_AC_CurrentC = 0.1f;
+    CHECK(Run(&engine, se, 0, 300) == 0, "imbalance raised below the minimum current");
+
+    // 6 A against 5 A is 19%: below the 20% of the default rule
+    se.I_AC_CurrentA = 6;
+    se.I_AC_CurrentB = se.I_AC_CurrentC = 5;
+    CHECK(Run(&engine, se, 300, 600) == 0, "imbalance raised at 19%%");
+
+    // 8 A against 5 A is 50%, raised after 60 s
+    se.I_AC_CurrentA = 8;
+    CHECK(Run(&engine, se, 600, 900, &event, &at) == 1 && strcmp(event.Name, "current_imbalance") == 0 && at == 660,
+          "imbalance raised at %u s, expected 660 s", (unsigned)at);
+    CHECK(event.Value == 50, "imbalance %g%%, expected 50%%", event.Value);
+}
+
+// a fault is raised on the first sample with the status and cleared on the first without it
+static void TestStatus(void)
+{
+    AlertEngine engine;
+    SolarEdge_t se = Normal();
+    uint8_t fault = 0;
+
+    CHECK(engine.Compile(AlertDefaultRules, AlertNumDefaultRules) == ESP_OK, "Compile");
+    for (uint8_t i = 0; i != engine.GetNumRules(); i++)
+        fault = (strcmp(engine.GetName(i), "fault") == 0) ? i : fault;
+
+    se.I_Status = 7;
+    CHECK(Run(&engine, se, 0, 1) == 1 && engine.IsActive(fault), "fault not raised");
+    CHECK(Run(&engine, Normal(), 1, 2) == 1 && !engine.IsActive(fault), "fault not cleared");
+}
+
+static void TestCompile(void)
+{
+    static AlertRule_t rules[ALERTS_MAX_RULES + 1];
+    AlertEngine engine;
+
+    for (AlertRule_t &r : rules)
+        r = AlertDefaultRules[0];
+
+    CHECK(engine.Compile(rules, ALERTS_MAX_RULES + 1) == ESP_ERR_INVALID_SIZE, "too many rules");
+
+    rules[1].Source = ALERT_SRC_MAX;
+    CHECK(engine.Compile(rules, 2) == ESP_ERR_INVALID_ARG, "unknown source");
+}
+
+//
+// AlertEngine::Evaluate() with samples at 1 s
+//
+int main(void)
+{
+    TestHysteresis();
+    TestDebounce();
+    TestPhases();
+    TestImbalance();
+    TestStatus();
+    TestCompile();
+
+    printf("%s\n", g_failed ? "FAILED" : "passed");
+
+    return g_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <esp_log.h>
+
+#include "BigNumberCells.h"
+
+#define TAG "BigNumberTest"
+
+#define TEST_WIDTH       (8 * TEST_DIGIT_WIDTH) // a box of 8 cells, like the power on the display
+#define TEST_DIGIT_WIDTH 20
+
+static int g_failed;
+
+#define CHECK(cond, format, ...)                                               \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            g_failed++;                                                        \
+            ESP_LOGE(TAG, "%s:%d " format, __func__, __LINE__, ##__VA_ARGS__); \
+        }                                                                      \
+    } while (0)
+
+// the advances of a proportional font: a narrow 1, the widest digit is TEST_DIGIT_WIDTH
+static int16_t Advance(uint32_t letter, const void *)
+{
+    switch (letter)
+    {
+        case '1':
+            return 11;
+        case '7':
+            return 17;
+        case '0':
+        case '8':
+            return TEST_DIGIT_WIDTH;
+        case '.':
+            return 6;
+        case ' ':
+            return 8;
+        case 'k':
+            return 16;
+        case 'W':
+            return 26;
+        default:
+            return (letter >= '0' && letter <= '9') ? 18 : 0;
+    }
+}
+
+// the columns redrawn by the last SetText()
+typedef struct
+{
+    uint8_t count;
+    int16_t x1[BIG_NUMBER_MAX_CHARS * 2];
+    int16_t x2[BIG_NUMBER_MAX_CHARS * 2];
+} Redrawn_t;
+
+static void Invalidate(int16_t x1, int16_t x2, void *ctx)
+{
+    Redrawn_t *r = (Redrawn_t *)ctx;
+
+    if (r->count != BIG_NUMBER_MAX_CHARS * 2)
+    {
+        r->x1[r->count] = x1;
+        r->x2[r->count] = x2;
+        r->count++;
+    }
+}
+
+static uint8_t Set(BigNumberCells *cells, const char *text, Redrawn_t *r)
+{
+    memset(r, 0, sizeof(*r));
+
+    uint8_t n = cells->SetText(text, Invalidate, r);
+
+    CHECK(n == r->count, "'%s': %u cells redrawn, %u invalidated", text, (unsigned)n, (unsigned)r->count);
+
+    return n;
+}
+
+// true when [x1, x2) is covered by the redrawn columns
+static bool Covered(const Redrawn_t *r, int16_t x1, int16_t x2)
+{
+    for (int16_t x = x1; x < x2; x++)
+    {
+        bool found = false;
+
+        for (uint8_t i = 0; i != r->count && !found; i++)
+            found = (x >= r->x1[i] && x < r->x2[i]);
+
+        if (!found)
+            return false;
+    }
+
+    return true;
+}
+
+// a digit that changes in place redraws only its own cell
+static void TestChangedCell(void)
+{
+    BigNumberCells cells;
+    Redrawn_t r;
+
+    cells.Init(TEST_WIDTH, TEST_DIGIT_WIDTH, true, Advance, nullptr);
+
+    CHECK(Set(&cells, "1234 W", &r) == 6, "first text: %u cells", (unsigned)r.count);
+    CHECK(Set(&cells, "1234 W", &r) == 0, "the same text redraws %u cells", (unsigned)r.count);
+
+    int16_t x1 = cells.GetX(3), x2 = cells.GetX(4);
+
+    CHECK(Set(&cells, "1237 W", &r) == 1 && r.x1[0] == x1 && r.x2[0] == x2, "one digit: %u cells, [%d, %d) expected [%d, %d)", (unsigned)r.count,
+          r.count ? r.x1[0] : -1, r.count ? r.x2[0] : -1, x1, x2);
+
+    // two digits, not next to each other
+    CHECK(Set(&cells, "8231 W", &r) == 2 && r.x1[0] == cells.GetX(0) && r.x1[1] == cells.GetX(3), "two digits: %u cells", (unsigned)r.count);
+}
+
+// a longer or shorter text moves every cell, the old cells beyond the new end are cleared
+static void TestLength(void)
+{
+    BigNumberCells cells;
+    Redrawn_t r;
+
+    cells.Init(TEST_WIDTH, TEST_DIGIT_WIDTH, true, Advance, nullptr);
+    Set(&cells, "999 W", &r);
+
+    int16_t old_start = cells.GetX(0), old_end = cells.GetX(5);
+
+    CHECK(Set(&cells, "1000 W", &r) == 6, "longer: %u cells", (unsigned)r.count);
+    CHECK(Covered(&r, old_start, old_end) && Covered(&r, cells.GetX(0), cells.GetX(6)), "longer: the old or the new cells are not redrawn");
+
+    old_start = cells.GetX(0);
+    old_end = cells.GetX(6);
+
+    // the tail of the old text: its last cell has no new cell
+    CHECK(Set(&cells, "12 W", &r) == 6, "shorter: %u cells", (unsigned)r.count);
+    CHECK(Covered(&r, old_start, old_end), "shorter: the old tail is not redrawn");
+    CHECK(cells.GetCount() == 4 && cells.GetLetter(3) == 'W', "shorter: %u cells", (unsigned)cells.GetCount());
+
+    old_start = cells.GetX(0);
+    old_end = cells.GetX(4);
+
+    CHECK(Set(&cells, "", &r) == 4 && Covered(&r, old_start, old_end) && cells.GetCount() == 0, "empty: %u cells", (unsigned)r.count);
+
+    // longer than the box holds: cut at BIG_NUMBER_MAX_CHARS
+    Set(&cells, "12345678901234", &r);
+    CHECK(cells.GetCount() == BIG_NUMBER_MAX_CHARS && r.count == BIG_NUMBER_MAX_CHARS, "%u cells of 14 letters", (unsigned)cells.GetCount());
+}
+
+// fixed: every digit takes the widest digit, values of the same length have the same cells
+static void TestFixed(void)
+{
+    BigNumberCells fixed, proportional;
+    Redrawn_t r;
+    static const char *values[] = { "1111.1 W", "8888.8 W", "1717.0 W", "4056.2 W" };
+
+    fixed.Init(TEST_WIDTH, TEST_DIGIT_WIDTH, true, Advance, nullptr);
+    proportional.Init(TEST_WIDTH, TEST_DIGIT_WIDTH, false, Advance, nullptr);
+
+    Set(&fixed, values[0], &r);
+    int16_t start = fixed.GetX(0), end = fixed.GetX(8);
+
+    for (const char *v : values)
+    {
+        Set(&fixed, v, &r);
+        Set(&proportional, v, &r);
+
+        CHECK(fixed.GetX(0) == start && fixed.GetX(8) == end, "'%s': the text moved to [%d, %d)", v, fixed.GetX(0), fixed.GetX(8));
+
+        for (uint8_t i = 0; i != fixed.GetCount(); i++)
+        {
+            if (v[i] >= '0' && v[i] <= '9')
+                CHECK(fixed.GetX(i + 1) - fixed.GetX(i) == TEST_DIGIT_WIDTH, "'%s': digit %u is %d wide", v, (unsigned)i,
+                      fixed.GetX(i + 1) - fixed.GetX(i));
+        }
+
+        // centered in the box
+        CHECK(abs(fixed.GetX(0) - (TEST_WIDTH - fixed.GetX(8))) <= 1, "'%s' is not centered", v);
+    }
+
+    // without fixed the width follows the digits, and a single digit moves the whole text
+    Set(&proportional, "1111.1 W", &r);
+    int16_t narrow = proportional.GetX(8) - proportional.GetX(0);
+    CHECK(Set(&proportional, "8111.1 W", &r) == 8 && proportional.GetX(8) - proportional.GetX(0) > narrow, "proportional: %u cells redrawn",
+          (unsigned)r.count);
+
+    // the same change with fixed: one cell
+    Set(&fixed, "1111.1 W", &r);
+    CHECK(Set(&fixed, "8111.1 W", &r) == 1, "fixed: %u cells redrawn", (unsigned)r.count);
+}
+
+//
+// BigNumberCells: the cells a BigNumber redraws when its text changes
+//
+int main(void)
+{
+    TestChangedCell();
+    TestLength();
+    TestFixed();
+
+    printf("%s\n", g_failed ? "FAILED" : "passed");
+
+    return g_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
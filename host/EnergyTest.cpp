@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <esp_log.h>
+
+#include "Energy.h"
+#include "Channels.h"
+#include "Trace.h"
+
+#define TAG "EnergyTest"
+
+// the synthetic trace starts at midnight, the sun is down: the counter is exact at the first sample
+#define TEST_SYNTH_START 1697580000
+
+static int g_failed;
+
+#define CHECK(cond, format, ...)                                          \
+    do                                                                    \
+    {                                                                     \
+        if (!(cond))                                                      \
+        {                                                                 \
+            g_failed++;                                                   \
+            ESP_LOGE(TAG, "%s:%d " format, __func__, __LINE__, ##__VA_ARGS__); \
+        }                                                                 \
+    } while (0)
+
+typedef struct
+{
+    double max_error;     // Wh, counter + offset against the reference
+    double mean_error;    // Wh
+    double counter_error; // Wh, mean error of the counter alone
+    float max_offset;     // Wh, largest |offset|
+    float max_step;       // Wh, largest step of the counter between two samples
+    uint32_t reanchors;
+} Replay_t;
+
+//
+// replay a trace, skipping the samples in [gap_from, gap_to). The reference is the energy the synthetic
+// trace steps its counter from: the power of a sample over the interval before it, summed in double
+// from the first counter value, also over the gap.
+//
+static void Replay(const Trace *trace, int64_t gap_from, int64_t gap_to, Replay_t *result)
+{
+    EnergyIntegrator energy;
+    SolarEdge_t se, prev;
+    double reference = 0, sum = 0, counter_sum = 0;
+    size_t n = 0;
+
+    *result = {};
+
+    for (size_t i = 0; i != trace->GetCount(); i++)
+    {
+        trace->Get(i, &se);
+
+        if (i == 0)
+            reference = se.I_AC_Energy_WH;
+        else
+        {
+            reference += (double)se.I_AC_Power * (se.Timestamp - prev.Timestamp) / 3.6e9;
+            if (se.I_AC_Energy_WH - prev.I_AC_Energy_WH > result->max_step)
+                result->max_step = se.I_AC_Energy_WH - prev.I_AC_Energy_WH;
+        }
+        prev = se;
+
+        if (se.Timestamp >= gap_from && se.Timestamp < gap_to)
+            continue;
+
+        energy.Add(se.Timestamp, se.I_AC_Power, se.I_DC_Power, se.I_AC_Energy_WH);
+
+        double error = fabs(se.I_AC_Energy_WH + energy.GetOffset() - reference);
+        if (error > result->max_error)
+            result->max_error = error;
+        if (fabsf(energy.GetOffset()) > result->max_offset)
+            result->max_offset = fabsf(energy.GetOffset());
+
+        sum += error;
+        counter_sum += fabs(se.I_AC_Energy_WH - reference);
+        n++;
+    }
+
+    result->mean_error = n ? sum / n : 0;
+    result->counter_error = n ? counter_sum / n : 0;
+    result->reanchors = energy.GetReanchors();
+}
+
+//
+// a day at 1 s and 5 s: the integration adds the resolution the counter lacks. It is re-anchored when the
+// counter steps, where the counter is short of the energy by up to a step, and drifts at most
+// ENERGY_MAX_DRIFT_WH from there.
+//
+static void TestSyntheticDay(void)
+{
+    static const uint32_t intervals[] = { 1, 5 };
+
+    for (uint32_t interval : intervals)
+    {
+        Trace trace;
+        Replay_t r;
+
+        CHECK(trace.Synthesize(TEST_SYNTH_START, 86400, interval) == ESP_OK, "Synthesize");
+        Replay(&trace, 0, 0, &r);
+
+        printf("synthetic %2us: max error %.3f Wh, mean %.3f Wh (counter alone %.3f Wh), %u re-anchors\n", (unsigned)interval, r.max_error,
+               r.mean_error, r.counter_error, (unsigned)r.reanchors);
+
+        CHECK(r.max_error < r.max_step + ENERGY_MAX_DRIFT_WH, "%us: max error %.3f Wh", (unsigned)interval, r.max_error);
+        CHECK(r.mean_error < r.counter_error, "%us: mean error %.3f Wh, counter alone %.3f Wh", (unsigned)interval, r.mean_error, r.counter_error);
+        CHECK(r.reanchors > 0 && r.reanchors < 86400 * 1000000LL / ENERGY_REANCHOR_US + 100, "%us: %u re-anchors", (unsigned)interval, (unsigned)r.reanchors);
+    }
+}
+
+// nothing is integrated over a gap, the next counter step re-anchors
+static void TestGap(void)
+{
+    Trace trace;
+    Replay_t r;
+    int64_t noon = (TEST_SYNTH_START + 12 * 3600) * 1000000LL;
+
+    CHECK(trace.Synthesize(TEST_SYNTH_START, 86400, 1) == ESP_OK, "Synthesize");
+    Replay(&trace, noon, noon + 5 * 60 * 1000000LL, &r);
+
+    printf("gap of 5 min: max error %.3f Wh, max offset %.3f Wh\n", r.max_error, r.max_offset);
+
+    CHECK(r.max_offset < 1 + ENERGY_MAX_DRIFT_WH, "offset %.3f Wh after the gap", r.max_offset);
+    CHECK(r.max_error < r.max_step + ENERGY_MAX_DRIFT_WH, "max error %.3f Wh", r.max_error);
+}
+
+// a counter that goes back (inverter replaced or reset) starts over
+static void TestCounterReset(void)
+{
+    EnergyIntegrator energy;
+    int64_t t = 0;
+
+    for (int i = 0; i != 100; i++, t += 1000000)
+        energy.Add(t, 3600, 3700, 1000 + i);
+
+    energy.Add(t, 3600, 3700, 5);
+    CHECK(energy.GetOffset() == 0, "offset %.3f after a reset", energy.GetOffset());
+
+    energy.Add(t + 1000000, 3600, 3700, 5);
+    CHECK(fabsf(energy.GetOffset() - 1) < 0.01f, "offset %.3f one second after a reset", energy.GetOffset());
+}
+
+static void TestEfficiency(void)
+{
+    EnergyIntegrator energy;
+
+    energy.Add(0, 0, 0, 100);
+    CHECK(energy.GetEfficiency() == 0, "efficiency %.2f without an interval", energy.GetEfficiency());
+
+    energy.Add(1000000, 1950, 2000, 100);
+    energy.Add(2000000, 1950, 2000, 100);
+    CHECK(fabsf(energy.GetEfficiency() - 97.5f) < 0.01f, "efficiency %.2f", energy.GetEfficiency());
+
+    energy.Add(3000000, 0, 0, 100);
+    energy.Add(4000000, 0, 0, 100);
+    CHECK(energy.GetEfficiency() == 0, "efficiency %.2f without power", energy.GetEfficiency());
+}
+
+// the production of the day on a counter of 30 MWh, where a float has a resolution of 2 Wh
+static void TestMidnight(void)
+{
+    SolarEdge_t se = {};
+
+    se.I_AC_Energy_WH = 30000000;
+    se.I_AC_Energy_WH_Frac = 0.4f;
+    SE_SetMidnight(&se);
+
+    se.I_AC_Energy_WH_Frac = 0.9f;
+    CHECK(fabsf(SE_EnergyToday(&se) - 0.5f) < 0.001f, "%.3f Wh, expected 0.5", SE_EnergyToday(&se));
+
+    se.I_AC_Energy_WH = 30000002;
+    se.I_AC_Energy_WH_Frac = 0.1f;
+    CHECK(fabsf(SE_EnergyToday(&se) - 1.7f) < 0.001f, "%.3f Wh, expected 1.7", SE_EnergyToday(&se));
+}
+
+// a recorded trace: only what holds for any trace
+static void TestRecorded(const char *path)
+{
+    Trace trace;
+    Replay_t r;
+
+    CHECK(trace.Load(path) == ESP_OK, "Load(%s)", path);
+    Replay(&trace, 0, 0, &r);
+
+    printf("%s: max error %.3f Wh, mean %.3f Wh (counter alone %.3f Wh), max offset %.3f Wh, %u re-anchors\n", path, r.max_error, r.mean_error,
+           r.counter_error, r.max_offset, (unsigned)r.reanchors);
+
+    CHECK(r.max_offset < 1 + ENERGY_MAX_DRIFT_WH, "max offset %.3f Wh", r.max_offset);
+}
+
+//
+// EnergyIntegrator against traces: se_energy_test [trace.lp ...]
+//
+int main(int argc, char *argv[])
+{
+    TestSyntheticDay();
+    TestGap();
+    TestCounterReset();
+    TestEfficiency();
+    TestMidnight();
+
+    for (int i = 1; i < argc; i++)
+        TestRecorded(argv[i]);
+
+    printf("%s\n", g_failed ? "FAILED" : "passed");
+
+    return g_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include "HistoryQuery.h"
+#include "Trace.h"
+
+#define TAG "HistoryBench"
+
+#define BENCH_DEFAULT_RUNS 100
+#define BENCH_DAYS         30
+
+// the synthetic trace: from midnight (2023-10-18, CEST), a day that is repeated for BENCH_DAYS
+#define BENCH_SYNTH_START 1697580000
+
+// the channels of the firmware, see main.cpp
+static const HistoryChannel_t HistoryChannels[] = {
+    { CH_I_AC_Power, 1.0f },
+    { CH_I_DC_Power, 1.0f },
+    { CH_I_Temp_Sink, 0.01f },
+    { CH_I_AC_VoltageAN, 0.1f },
+};
+
+typedef struct
+{
+    const HistoryQuery_t *query;
+    uint32_t points;
+    time_t last;
+    bool ordered; // the points are in time order
+    bool inside;  // and in the buckets of the range
+} Check_t;
+
+static bool CheckPoint(const HistoryPoint_t *point, void *ctx)
+{
+    Check_t *check = (Check_t *)ctx;
+
+    if (check->points && point->start < check->last)
+        check->ordered = false;
+    if (point->start >= check->query->to || point->min > point->mean || point->mean > point->max)
+        check->inside = false;
+
+    check->last = point->start;
+    check->points++;
+
+    return true;
+}
+
+//
+// run a query, the first run checks the points, the time is the mean of all runs.
+// Returns false when the points or the number of slots read are not what the query allows.
+//
+static bool Bench(HistoryStore *store, const char *name, const HistoryQuery_t *query, time_t now, uint32_t runs)
+{
+    Check_t check = { query, 0, 0, true, true };
+    HistoryResult_t result;
+    bool ok = true;
+
+    if (HistoryRun(store, query, now, CheckPoint, &check, &result) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "%s: HistoryRun failed", name);
+        return false;
+    }
+
+    int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i != runs; i++)
+    {
+        Check_t ignore = check;
+        HistoryRun(store, query, now, CheckPoint, &ignore, &result);
+    }
+    double us = (double)(esp_timer_get_time() - start) / (runs ? runs : 1);
+
+    // a bucket gives a point, M4 up to four. LTTB reads every bucket twice, for the average of the next one
+    uint32_t buckets = query->width + 1;
+    uint32_t max_points = (query->mode == HISTORY_M4) ? 4 * buckets : buckets + 1;
+    uint32_t interval = HistoryTiers[result.tier].interval;
+    uint32_t max_slots = (query->mode == HISTORY_LTTB ? 2 : 1) * (HistoryTiers[result.tier].depth + 2 * result.step / interval);
+
+    printf("%-6s %-7s %5u %4u %6u %6u %6u %9.1f\n", HistoryModeName(query->mode), name, (unsigned)query->width, (unsigned)result.tier,
+           (unsigned)result.step, (unsigned)result.slots, (unsigned)result.points, us);
+
+    if (!check.ordered || !check.inside)
+    {
+        ESP_LOGE(TAG, "%s %s: points out of order or outside the range", HistoryModeName(query->mode), name);
+        ok = false;
+    }
+    if (check.points != result.points || result.points > max_points || result.slots > max_slots)
+    {
+        ESP_LOGE(TAG, "%s %s: %u points (at most %u), %u slots read (at most %u)", HistoryModeName(query->mode), name, (unsigned)result.points,
+                 (unsigned)max_points, (unsigned)result.slots, (unsigned)max_slots);
+        ok = false;
+    }
+
+    return ok;
+}
+
+static void Usage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [-n runs] [-i interval]\n"
+            "  -n  runs per query, default %d\n"
+            "  -i  seconds between the samples of the %d days in the store, default 1\n",
+            name, BENCH_DEFAULT_RUNS, BENCH_DAYS);
+}
+
+//
+// HistoryRun() over 30 days of samples: every mode, range and width, the tier it selects, the slots it
+// reads and the time per query. Fails when a query breaks its bounds.
+//
+int main(int argc, char *argv[])
+{
+    static const struct
+    {
+        const char *name;
+        time_t seconds;
+    } ranges[] = {
+        { "1h", 3600 }, { "24h", 86400 }, { "7d", 7 * 86400 }, { "30d", BENCH_DAYS * 86400 }, { "all", 0 },
+    };
+    static const uint16_t widths[] = { 100, 600, 2000 };
+
+    uint32_t runs = BENCH_DEFAULT_RUNS, interval = 1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:i:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                runs = strtoul(optarg, nullptr, 10);
+                break;
+            case 'i':
+                interval = strtoul(optarg, nullptr, 10);
+                break;
+            default:
+                Usage(argv[0]);
+                return 1;
+        }
+    }
+
+    static Trace trace;
+    static HistoryStore store(HistoryChannels, sizeof(HistoryChannels) / sizeof(HistoryChannels[0]));
+    SolarEdge_t se;
+
+    if (interval == 0 || trace.Synthesize(BENCH_SYNTH_START, 86400, interval) != ESP_OK || store.Init() != ESP_OK)
+    {
+        ESP_LOGE(TAG, "no samples or no store");
+        return 1;
+    }
+
+    // the store gets the samples like the main loop gives them
+    size_t samples = (size_t)BENCH_DAYS * 86400 / interval;
+    int64_t start = esp_timer_get_time();
+    for (size_t i = 0; i != samples; i++)
+    {
+        trace.Get(i, &se);
+        store.Add(se.Timestamp / 1000000, &se);
+    }
+    time_t now = se.Timestamp / 1000000 + 1;
+
+    printf("%u samples added in %.1f ms, %.3f us per sample\n\n", (unsigned)samples, (esp_timer_get_time() - start) / 1000.0,
+           (double)(esp_timer_get_time() - start) / samples);
+    printf("%-6s %-7s %5s %4s %6s %6s %6s %9s\n", "mode", "range", "width", "tier", "step", "slots", "points", "us");
+
+    bool ok = true;
+    for (int mode = 0; mode != HISTORY_MODE_MAX; mode++)
+    {
+        for (size_t r = 0; r != sizeof(ranges) / sizeof(ranges[0]); r++)
+        {
+            for (size_t w = 0; w != sizeof(widths) / sizeof(widths[0]); w++)
+            {
+                // "all": from the epoch, HistoryRun() clamps it to what the store can hold
+                HistoryQuery_t query = { 0, ranges[r].seconds ? now - ranges[r].seconds : 0, now, widths[w], (HistoryMode_t)mode };
+
+                ok &= Bench(&store, ranges[r].name, &query, now, runs);
+            }
+        }
+    }
+
+    printf("\n%s\n", ok ? "passed" : "FAILED");
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <esp_err.h>
+
+#include <lvgl.h>
+
+typedef enum {
+    HOST_DRAW_RECT = 0,
+    HOST_DRAW_ARC,
+    HOST_DRAW_IMG,
+    HOST_DRAW_LETTER,
+    HOST_DRAW_LINE,
+    HOST_DRAW_POLYGON,
+    HOST_DRAW_MAX
+} HostDraw_t;
+
+typedef struct
+{
+    uint32_t frames;    // refreshes that rendered something
+    uint64_t render_us; // lv_refr_now(), rendering and copying into the framebuffer
+    uint64_t pixels;    // the invalidated area that was rendered
+    uint32_t flushes;   // areas passed to the flush callback, a draw buffer each
+    uint32_t draw_calls[HOST_DRAW_MAX];
+} HostFrameStats_t;
+
+//
+// The display of the host build (lcd_host.cpp): LCDInit() registers an 800x480 RGB565 framebuffer in memory,
+// with draw buffers of CONFIG_SOLAREDGE_LCD_DRAW_LINES lines like the default pipeline of the board.
+// Nothing is rendered until HostDisplayRefresh().
+//
+
+// render what was invalidated, the counters of this refresh are added to stats
+void HostDisplayRefresh(HostFrameStats_t *stats);
+
+// the framebuffer, LCD_H_RES * LCD_V_RES pixels
+const uint16_t *HostDisplayFramebuffer(void);
+
+const char *HostDrawName(HostDraw_t draw);
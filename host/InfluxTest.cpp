@@ -0,0 +1,213 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include <esp_log.h>
+
+#include "Influx.h"
+#include "Channels.h"
+#include "Trace.h"
+
+#define TAG "InfluxTest"
+
+#define TEST_SYNTH_START 1697580000
+#define TEST_SAMPLES     40 // more than the queue and the largest batch hold
+
+static int g_failed;
+
+#define PREFIX(line, prefix) (strncmp(line, prefix, strlen(prefix)) == 0)
+
+#define CHECK(cond, format, ...)                                               \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            g_failed++;                                                        \
+            ESP_LOGE(TAG, "%s:%d " format, __func__, __LINE__, ##__VA_ARGS__); \
+        }                                                                      \
+    } while (0)
+
+// the measurement, tags and timestamp of a line
+static void TestFormatLine(void)
+{
+    InfluxSink sink;
+    SolarEdge_t se = {};
+    char line[INFLUX_LINE_SIZE];
+    size_t n;
+
+    CHECK(sink.Configure("udp://127.0.0.1:8089", nullptr, 10, 10) == ESP_OK, "Configure");
+
+    se.Timestamp = 1697666400123456LL;
+    se.I_AC_Power = 1234.5f;
+    se.I_Status = 4;
+    strcpy((char *)se.C_SerialNumber, "7E0A1B2C    ");
+
+    n = sink.FormatLine(&se, line, sizeof(line));
+    CHECK(n == strlen(line) && n > 0 && line[n - 1] == '\n', "length %u", (unsigned)n);
+    CHECK(PREFIX(line, "solaredge,serial=7E0A1B2C I_AC_Current=0,"), "prefix: %s", line);
+    CHECK(strstr(line, ",I_AC_Power=1234.5,") != nullptr, "power: %s", line);
+    CHECK(strstr(line, ",I_Status=4i,I_Status_Vendor=0i 1697666400123456000\n") != nullptr, "end: %s", line);
+
+    // a new inverter: the prefix is rebuilt, the separators of the line protocol are escaped
+    strcpy((char *)se.C_SerialNumber, "SE 1,2=3");
+    n = sink.FormatLine(&se, line, sizeof(line));
+    CHECK(PREFIX(line, "solaredge,serial=SE\\ 1\\,2\\=3 I_AC_Current="), "escaped prefix: %s", line);
+
+    // no serial number: no tag
+    memset(se.C_SerialNumber, 0, sizeof(se.C_SerialNumber));
+    n = sink.FormatLine(&se, line, sizeof(line));
+    CHECK(PREFIX(line, "solaredge I_AC_Current="), "prefix without serial: %s", line);
+
+    CHECK(sink.FormatLine(&se, line, 64) == 0, "a line that does not fit");
+
+    CHECK(sink.Configure("udp://127.0.0.1:8089", "pv", 10, 10) == ESP_OK, "Configure");
+    n = sink.FormatLine(&se, line, sizeof(line));
+    CHECK(PREFIX(line, "pv I_AC_Current="), "measurement: %s", line);
+
+    CHECK(sink.Configure("http://127.0.0.1:8089", nullptr, 10, 10) == ESP_ERR_INVALID_ARG, "scheme");
+    CHECK(sink.Configure("udp://127.0.0.1", nullptr, 10, 10) == ESP_ERR_INVALID_ARG, "no port");
+    CHECK(sink.Configure("udp://127.0.0.1:70000", nullptr, 10, 10) == ESP_ERR_INVALID_ARG, "port");
+}
+
+// the lines of the synthetic day read back by the trace parser: every channel survives the formatting, with two decimals
+static void TestRoundTrip(void)
+{
+    InfluxSink sink;
+    Trace trace, parsed;
+    SolarEdge_t se, back;
+    char line[INFLUX_LINE_SIZE];
+    char path[] = "/tmp/se_influx_XXXXXX";
+    int fd = mkstemp(path);
+    FILE *f = (fd >= 0) ? fdopen(fd, "w") : nullptr;
+
+    CHECK(f != nullptr, "mkstemp");
+    if (!f)
+        return;
+
+    CHECK(sink.Configure("udp://127.0.0.1:8089", nullptr, 10, 10) == ESP_OK, "Configure");
+    CHECK(trace.Synthesize(TEST_SYNTH_START, 86400, 60) == ESP_OK, "Synthesize");
+
+    for (size_t i = 0; i != trace.GetCount(); i++)
+    {
+        trace.Get(i, &se);
+        fputs(sink.FormatLine(&se, line, sizeof(line)) ? line : "", f);
+    }
+    fclose(f);
+
+    CHECK(parsed.Load(path) == ESP_OK && parsed.GetCount() == trace.GetCount(), "%u of %u lines parsed", (unsigned)parsed.GetCount(),
+          (unsigned)trace.GetCount());
+    unlink(path);
+
+    for (size_t i = 0; i != parsed.GetCount() && i != trace.GetCount(); i++)
+    {
+        trace.Get(i, &se);
+        parsed.Get(i, &back);
+
+        CHECK(back.Timestamp == se.Timestamp && back.I_Status == se.I_Status && strcmp((char *)back.C_SerialNumber, (char *)se.C_SerialNumber) == 0,
+              "sample %u: timestamp, status or serial", (unsigned)i);
+
+        for (int ch = 0; ch != CH_MAX; ch++)
+        {
+            float a = SE_ChannelValue(&se, (SEChannel_t)ch), b = SE_ChannelValue(&back, (SEChannel_t)ch);
+
+            CHECK(fabsf(a - b) <= 0.005f + 1e-6f * fabsf(a), "sample %u: %s %g != %g", (unsigned)i, SE_Channels[ch].Name, a, b);
+        }
+    }
+}
+
+//
+// the sender task against a local udp listener: every datagram holds complete lines and fits
+// INFLUX_UDP_PAYLOAD, all lines arrive once and in order
+//
+static void TestUdp(void)
+{
+    static char expected[TEST_SAMPLES * INFLUX_LINE_SIZE], received[TEST_SAMPLES * INFLUX_LINE_SIZE];
+    static InfluxSink sink; // the sender task never ends
+    InfluxSink format;
+    Trace trace;
+    SolarEdge_t se;
+    static char datagram[INFLUX_BUFFER_SIZE];
+    char uri[64];
+    size_t expected_len = 0, received_len = 0;
+    uint32_t datagrams = 0, largest = 0, full = 0;
+
+    int listener = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in addr = {};
+    socklen_t addr_len = sizeof(addr);
+    struct timeval timeout = { 3, 0 };
+
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    CHECK(listener >= 0 && bind(listener, (struct sockaddr *)&addr, sizeof(addr)) == 0, "bind");
+    getsockname(listener, (struct sockaddr *)&addr, &addr_len);
+    setsockopt(listener, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    snprintf(uri, sizeof(uri), "udp://127.0.0.1:%u", ntohs(addr.sin_port));
+    CHECK(sink.Configure(uri, nullptr, INFLUX_MAX_BATCH, 1) == ESP_OK, "Configure(%s)", uri);
+    CHECK(format.Configure(uri, nullptr, INFLUX_MAX_BATCH, 1) == ESP_OK, "Configure(%s)", uri);
+    CHECK(sink.Start() == ESP_OK, "Start");
+
+    CHECK(trace.Synthesize(TEST_SYNTH_START + 12 * 3600, TEST_SAMPLES, 1) == ESP_OK, "Synthesize");
+    for (size_t i = 0; i != TEST_SAMPLES; i++)
+    {
+        trace.Get(i, &se);
+        expected_len += format.FormatLine(&se, expected + expected_len, sizeof(expected) - expected_len);
+
+        // the queue holds INFLUX_QUEUE_SIZE - 1 samples: the main loop drops the sample, the test tries again
+        while (!sink.Push(&se))
+        {
+            full++;
+            usleep(1000);
+        }
+    }
+
+    while (received_len < expected_len)
+    {
+        ssize_t n = recv(listener, datagram, sizeof(datagram), 0);
+
+        if (n <= 0)
+            break;
+
+        CHECK(n <= INFLUX_UDP_PAYLOAD || memchr(datagram, '\n', n) == datagram + n - 1, "datagram of %d bytes with more than one line", (int)n);
+        CHECK(datagram[n - 1] == '\n', "datagram %u does not end with a complete line", (unsigned)datagrams);
+
+        if (received_len + n <= sizeof(received))
+            memcpy(received + received_len, datagram, n);
+        received_len += n;
+        datagrams++;
+        if ((uint32_t)n > largest)
+            largest = n;
+    }
+
+    close(listener);
+
+    printf("udp: %u lines in %u datagrams of up to %u bytes\n", (unsigned)TEST_SAMPLES, (unsigned)datagrams, (unsigned)largest);
+
+    // the sender counts a batch after its last datagram
+    for (int i = 0; i != 1000 && sink.GetSent() != TEST_SAMPLES; i++)
+        usleep(1000);
+
+    CHECK(received_len == expected_len && memcmp(received, expected, expected_len) == 0, "%u of %u bytes received, or not in order",
+          (unsigned)received_len, (unsigned)expected_len);
+    CHECK(sink.GetSent() == TEST_SAMPLES && sink.GetDropped() == full && sink.GetErrors() == 0, "sent %u, dropped %u, errors %u",
+          (unsigned)sink.GetSent(), (unsigned)sink.GetDropped(), (unsigned)sink.GetErrors());
+}
+
+//
+// InfluxSink: the line protocol and the udp datagrams
+//
+int main(void)
+{
+    TestFormatLine();
+    TestRoundTrip();
+    TestUdp();
+
+    printf("%s\n", g_failed ? "FAILED" : "passed");
+
+    return g_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Png.h"
+
+// the largest stored deflate block
+#define PNG_BLOCK_SIZE 65535
+
+static uint32_t CrcTable[256];
+
+static void CrcInit(void)
+{
+    for (uint32_t n = 0; n != 256; n++)
+    {
+        uint32_t c = n;
+        for (int k = 0; k != 8; k++)
+            c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+        CrcTable[n] = c;
+    }
+}
+
+static uint32_t Crc(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i != len; i++)
+        crc = CrcTable[(crc ^ buf[i]) & 0xff] ^ (crc >> 8);
+
+    return crc;
+}
+
+typedef struct
+{
+    FILE *f;
+    uint32_t crc;     // of the chunk
+    uint32_t adler_a; // of the zlib stream
+    uint32_t adler_b;
+} PngOut_t;
+
+static void Put(PngOut_t *out, const uint8_t *buf, size_t len)
+{
+    fwrite(buf, 1, len, out->f);
+    out->crc = Crc(out->crc, buf, len);
+}
+
+static void Put32(PngOut_t *out, uint32_t value)
+{
+    uint8_t buf[4] = { (uint8_t)(value >> 24), (uint8_t)(value >> 16), (uint8_t)(value >> 8), (uint8_t)value };
+    Put(out, buf, sizeof(buf));
+}
+
+static void ChunkBegin(PngOut_t *out, const char *type, uint32_t len)
+{
+    Put32(out, len);
+    out->crc = 0xffffffff;
+    Put(out, (const uint8_t *)type, 4);
+}
+
+static void ChunkEnd(PngOut_t *out) { Put32(out, out->crc ^ 0xffffffff); }
+
+// image data, into the zlib checksum and a stored deflate block
+static void PutData(PngOut_t *out, const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i != len; i++)
+    {
+        out->adler_a = (out->adler_a + buf[i]) % 65521;
+        out->adler_b = (out->adler_b + out->adler_a) % 65521;
+    }
+
+    Put(out, buf, len);
+}
+
+esp_err_t PngWrite(const char *path, const uint16_t *rgb565, uint16_t width, uint16_t height)
+{
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    static const uint8_t zlib_header[2] = { 0x78, 0x01 };
+
+    // a row: the filter type and 3 bytes per pixel
+    size_t row_size = 1 + (size_t)width * 3;
+    size_t raw_size = row_size * height;
+    size_t blocks = (raw_size + PNG_BLOCK_SIZE - 1) / PNG_BLOCK_SIZE;
+
+    uint8_t *row = (uint8_t *)malloc(row_size);
+    if (!row)
+        return ESP_ERR_NO_MEM;
+
+    PngOut_t out = { fopen(path, "wb"), 0, 1, 0 };
+    if (!out.f)
+    {
+        free(row);
+        return ESP_FAIL;
+    }
+
+    CrcInit();
+    Put(&out, signature, sizeof(signature));
+
+    ChunkBegin(&out, "IHDR", 13);
+    Put32(&out, width);
+    Put32(&out, height);
+    uint8_t ihdr[5] = { 8, 2, 0, 0, 0 }; // 8 bit, RGB, deflate, no filter, no interlace
+    Put(&out, ihdr, sizeof(ihdr));
+    ChunkEnd(&out);
+
+    ChunkBegin(&out, "IDAT", sizeof(zlib_header) + raw_size + blocks * 5 + 4);
+    Put(&out, zlib_header, sizeof(zlib_header));
+
+    size_t pos = 0, block_left = 0;
+
+    for (uint16_t y = 0; y != height; y++)
+    {
+        const uint16_t *px = &rgb565[(size_t)y * width];
+        uint8_t *p = row;
+
+        *p++ = 0;
+        for (uint16_t x = 0; x != width; x++)
+        {
+            // expand 5 and 6 bits to 8, the white of the display stays white
+            uint8_t r = (px[x] >> 11) & 0x1f, g = (px[x] >> 5) & 0x3f, b = px[x] & 0x1f;
+            *p++ = (r << 3) | (r >> 2);
+            *p++ = (g << 2) | (g >> 4);
+            *p++ = (b << 3) | (b >> 2);
+        }
+
+        // the blocks do not follow the rows
+        for (size_t done = 0; done != row_size;)
+        {
+            if (block_left == 0)
+            {
+                block_left = (raw_size - pos < PNG_BLOCK_SIZE) ? raw_size - pos : PNG_BLOCK_SIZE;
+                uint8_t header[5] = { (uint8_t)(pos + block_left == raw_size), (uint8_t)block_left, (uint8_t)(block_left >> 8),
+                                      (uint8_t)~block_left, (uint8_t)(~block_left >> 8) };
+                Put(&out, header, sizeof(header));
+            }
+
+            size_t n = (row_size - done < block_left) ? row_size - done : block_left;
+            PutData(&out, row + done, n);
+            done += n;
+            pos += n;
+            block_left -= n;
+        }
+    }
+
+    Put32(&out, (out.adler_b << 16) | out.adler_a);
+    ChunkEnd(&out);
+
+    ChunkBegin(&out, "IEND", 0);
+    ChunkEnd(&out);
+
+    bool ok = !ferror(out.f);
+    fclose(out.f);
+    free(row);
+
+    return ok ? ESP_OK : ESP_FAIL;
+}
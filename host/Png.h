@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <esp_err.h>
+
+//
+// writes an RGB565 image as an 8 bit RGB png. The deflate stream is stored, not compressed:
+// the snapshots are compared, not archived, and no zlib is needed.
+//
+esp_err_t PngWrite(const char *path, const uint16_t *rgb565, uint16_t width, uint16_t height);
@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <unistd.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include "Smooth.h"
+
+#define TAG "SmoothBench"
+
+#define BENCH_DEFAULT_SAMPLES 100000
+#define BENCH_CHANNELS        8 // the channels of a chart panel
+
+static volatile float g_sink; // keeps the reads of the results in the timed loops
+
+//
+// the window the way a fixed array is usually averaged: a ring, and a loop over all samples for the
+// average, min and max of every channel
+//
+template <size_t N, size_t C> class NaiveBank
+{
+    float ring[N][C];
+    size_t head = 0, fill = 0;
+
+public:
+    float avg[C], min[C], max[C];
+
+    void add(const float *val)
+    {
+        for (size_t c = 0; c != C; c++)
+            ring[head][c] = val[c];
+        head = (head + 1) % N;
+        fill += (fill < N);
+
+        for (size_t c = 0; c != C; c++)
+        {
+            float sum = 0, mn = ring[0][c], mx = ring[0][c];
+
+            for (size_t i = 0; i != fill; i++)
+            {
+                sum += ring[i][c];
+                mn = (ring[i][c] < mn) ? ring[i][c] : mn;
+                mx = (ring[i][c] > mx) ? ring[i][c] : mx;
+            }
+            avg[c] = sum / fill;
+            min[c] = mn;
+            max[c] = mx;
+        }
+    }
+};
+
+// a day of AC power in W, with clouds: the samples of the benchmark
+static float Sample(uint32_t i, size_t c)
+{
+    float sun = sinf((float)(i % 86400) * (float)M_PI / 86400);
+
+    return (5000 + 100 * c) * sun * sun * (0.7f + 0.3f * sinf(i * 0.37f + c)) + (float)(i % 7);
+}
+
+//
+// add the samples of the trace to a SmoothBank and to the naive window, read average, min and max after every sample.
+// Returns false when the results of the two differ.
+//
+template <size_t N> static bool Bench(const float *trace, uint32_t samples)
+{
+    static SmoothBank<float, N, BENCH_CHANNELS> bank;
+    static NaiveBank<N, BENCH_CHANNELS> naive;
+    float sink = 0;
+    bool ok = true;
+
+    int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i != samples; i++)
+    {
+        bank.add(trace + i * BENCH_CHANNELS);
+
+        for (size_t c = 0; c != BENCH_CHANNELS; c++)
+            sink += bank.get_avg(c) + bank.get_min(c) + bank.get_max(c);
+    }
+    double smooth_ns = (esp_timer_get_time() - start) * 1000.0 / samples;
+
+    start = esp_timer_get_time();
+    for (uint32_t i = 0; i != samples; i++)
+    {
+        naive.add(trace + i * BENCH_CHANNELS);
+
+        for (size_t c = 0; c != BENCH_CHANNELS; c++)
+            sink += naive.avg[c] + naive.min[c] + naive.max[c];
+    }
+    double naive_ns = (esp_timer_get_time() - start) * 1000.0 / samples;
+
+    // the last window of both: the naive sum is in float as well, allow for its rounding
+    for (size_t c = 0; c != BENCH_CHANNELS; c++)
+    {
+        if (fabsf(bank.get_avg(c) - naive.avg[c]) > 1e-3f * (1 + fabsf(naive.avg[c])) || bank.get_min(c) != naive.min[c] || bank.get_max(c) != naive.max[c])
+        {
+            ESP_LOGE(TAG, "window %u, channel %u: avg %g min %g max %g, naive %g %g %g", (unsigned)N, (unsigned)c, bank.get_avg(c), bank.get_min(c),
+                     bank.get_max(c), naive.avg[c], naive.min[c], naive.max[c]);
+            ok = false;
+        }
+    }
+
+    g_sink = sink;
+    printf("%6u %9.1f %9.1f %7.1fx\n", (unsigned)N, smooth_ns, naive_ns, naive_ns / smooth_ns);
+
+    return ok;
+}
+
+static void Usage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [-n samples]\n"
+            "  -n  samples per window size, default %d\n",
+            name, BENCH_DEFAULT_SAMPLES);
+}
+
+//
+// SmoothBank<float, N, 8> against a loop over the window, for the window sizes of the charts:
+// ns per sample for add() and reading average, min and max of every channel. Fails when they differ.
+//
+int main(int argc, char *argv[])
+{
+    uint32_t samples = BENCH_DEFAULT_SAMPLES;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                samples = strtoul(optarg, nullptr, 10);
+                break;
+            default:
+                Usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (samples == 0)
+    {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    // the samples are computed in advance, the timed loops only add and read
+    float *trace = (float *)malloc(sizeof(float) * BENCH_CHANNELS * samples);
+
+    if (!trace)
+    {
+        ESP_LOGE(TAG, "no memory for %u samples", (unsigned)samples);
+        return 1;
+    }
+    for (uint32_t i = 0; i != samples; i++)
+        for (size_t c = 0; c != BENCH_CHANNELS; c++)
+            trace[i * BENCH_CHANNELS + c] = Sample(i, c);
+
+    printf("%u channels, %u samples\n\n", (unsigned)BENCH_CHANNELS, (unsigned)samples);
+    printf("%6s %9s %9s %8s\n", "window", "smooth ns", "naive ns", "speedup");
+
+    bool ok = true;
+    ok &= Bench<10>(trace, samples);
+    ok &= Bench<60>(trace, samples);
+    ok &= Bench<360>(trace, samples);
+    ok &= Bench<3600>(trace, samples);
+
+    free(trace);
+
+    printf("\n%s\n", ok ? "passed" : "FAILED");
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <deque>
+#include <random>
+#include <vector>
+
+#include <esp_log.h>
+
+#include "Smooth.h"
+
+#define TAG "SmoothTest"
+
+#define TEST_SAMPLES 20000
+
+static int g_failed;
+
+#define CHECK(cond, format, ...)                                               \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            g_failed++;                                                        \
+            ESP_LOGE(TAG, "%s:%d " format, __func__, __LINE__, ##__VA_ARGS__); \
+        }                                                                      \
+    } while (0)
+
+// the window the obvious way: every statistic from all samples, in double
+class NaiveWindow
+{
+    std::deque<double> window;
+    size_t size;
+
+public:
+    explicit NaiveWindow(size_t n) : size(n) { }
+
+    void add(double v)
+    {
+        window.push_back(v);
+        if (window.size() > size)
+            window.pop_front();
+    }
+
+    double avg(void) const
+    {
+        double sum = 0;
+
+        for (double v : window)
+            sum += v;
+        return sum / window.size();
+    }
+
+    double variance(void) const
+    {
+        double m = avg(), sum = 0;
+
+        for (double v : window)
+            sum += (v - m) * (v - m);
+        return sum / window.size();
+    }
+
+    double min(void) const
+    {
+        double m = window.front();
+
+        for (double v : window)
+            m = (v < m) ? v : m;
+        return m;
+    }
+
+    double max(void) const
+    {
+        double m = window.front();
+
+        for (double v : window)
+            m = (v > m) ? v : m;
+        return m;
+    }
+
+    size_t fill(void) const { return window.size(); }
+};
+
+//
+// C channels of random samples around base, every sample compared with the naive window.
+// tolerance is relative to the spread of the samples, 0 for exact integer results
+//
+template <typename T, size_t N, size_t C, bool V> static void Compare(const char *name, double base, double spread, double tolerance)
+{
+    static SmoothBank<T, N, C, V> bank; // large windows do not fit the stack
+    std::vector<NaiveWindow> naive(C, NaiveWindow(N));
+    std::mt19937 rng(N * 31 + C);
+    std::uniform_real_distribution<double> noise(-spread, spread);
+    double worst_avg = 0, worst_var = 0;
+    uint32_t errors = 0;
+
+    bank.reset();
+
+    for (uint32_t i = 0; i != TEST_SAMPLES; i++)
+    {
+        T val[C];
+
+        // a step every 5000 samples, so the window sees a trend as well as noise
+        for (size_t c = 0; c != C; c++)
+        {
+            double v = base * (c + 1) + noise(rng) + ((i / 5000) & 1) * spread * 4;
+
+            val[c] = std::is_floating_point<T>::value ? (T)v : (T)lround(v);
+            naive[c].add((double)val[c]);
+        }
+        bank.add(val);
+
+        for (size_t c = 0; c != C; c++)
+        {
+            double avg_error = fabs((double)bank.get_avg(c) - naive[c].avg()) / spread;
+
+            worst_avg = (avg_error > worst_avg) ? avg_error : worst_avg;
+
+            // integer averages are truncated, less than 1 off
+            if (avg_error > (std::is_floating_point<T>::value ? tolerance : 1 / spread))
+                errors++;
+            if ((double)bank.get_min(c) != naive[c].min() || (double)bank.get_max(c) != naive[c].max())
+                errors++;
+            if (bank.get_fill() != naive[c].fill())
+                errors++;
+
+            if constexpr (V)
+            {
+                double var_error = fabs((double)bank.get_variance(c) - naive[c].variance()) / (spread * spread);
+
+                worst_var = (var_error > worst_var) ? var_error : worst_var;
+                if (var_error > tolerance)
+                    errors++;
+            }
+        }
+    }
+
+    printf("%-8s window %5u, %u channels: worst average error %.2e, variance %.2e of the spread\n", name, (unsigned)N, (unsigned)C, worst_avg,
+           worst_var);
+
+    CHECK(errors == 0, "%s N=%u C=%u: %u samples differ from the naive window", name, (unsigned)N, (unsigned)C, (unsigned)errors);
+    CHECK(bank.get_count() == TEST_SAMPLES, "%s: count %u", name, (unsigned)bank.get_count());
+}
+
+// the float sums are rebuilt when the ring wraps: no drift over many windows of a large value with small changes
+static void TestDrift(void)
+{
+    static Smooth<float, 60> smooth;
+    NaiveWindow naive(60);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> noise(-0.5, 0.5);
+    double worst = 0;
+
+    for (uint32_t i = 0; i != 1000000; i++)
+    {
+        float v = (float)(230000.0 + noise(rng));
+
+        naive.add(v);
+        smooth += v;
+
+        double error = fabs(smooth() - naive.avg());
+        worst = (error > worst) ? error : worst;
+    }
+
+    printf("drift: worst average error %.4f after 1e6 samples of 230000 +/- 0.5\n", worst);
+    CHECK(worst < 0.05, "average drifted by %.4f", worst);
+}
+
+static uint32_t g_changes, g_lower, g_upper;
+
+static void OnChange(double const) { g_changes++; }
+static void OnLower(double const) { g_lower++; }
+static void OnUpper(double const) { g_upper++; }
+
+// the lower and upper callbacks fire once per crossing, and again only after the average moved back past the hysteresis
+static void TestCallbacks(void)
+{
+    Smooth<int32_t, 1> smooth; // a window of 1: the average is the sample
+    static const int32_t samples[] = { 50, 9, 8, 11, 9, 12, 8, 50, 90, 95, 89, 91, 85, 92, 50 };
+
+    smooth.set_change(OnChange);
+    smooth.set_lower(OnLower, 10, 2); // below 10, armed again at 12
+    smooth.set_upper(OnUpper, 90, 3); // at or above 90, armed again below 87
+
+    for (int32_t v : samples)
+        smooth += v;
+
+    CHECK(g_lower == 2, "lower fired %u times, expected 2", (unsigned)g_lower);
+    CHECK(g_upper == 2, "upper fired %u times, expected 2", (unsigned)g_upper);
+    CHECK(g_changes == sizeof(samples) / sizeof(samples[0]), "change fired %u times", (unsigned)g_changes);
+
+    smooth.reset();
+    smooth += 1;
+    CHECK(g_lower == 2 && smooth.get_fill() == 1 && smooth() == 1, "callbacks after reset()");
+}
+
+//
+// SmoothBank and Smooth against a naive window
+//
+int main(void)
+{
+    Compare<float, 1, 1, true>("float", 1000, 10, 1e-4);
+    Compare<float, 10, 3, true>("float", 1000, 10, 1e-4);
+    Compare<float, 360, 4, true>("float", 230, 5, 1e-4);
+    Compare<double, 3600, 2, true>("double", 1e6, 100, 1e-9);
+    Compare<int32_t, 7, 3, false>("int32_t", 100000, 1000, 0);
+    Compare<int16_t, 64, 2, false>("int16_t", 1000, 500, 0);
+    Compare<uint8_t, 5, 1, false>("uint8_t", 100, 20, 0);
+
+    TestDrift();
+    TestCallbacks();
+
+    printf("%s\n", g_failed ? "FAILED" : "passed");
+
+    return g_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
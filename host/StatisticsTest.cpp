@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <esp_log.h>
+
+#include "Statistics.h"
+#include "TDigest.h"
+
+#define TAG "StatisticsTest"
+
+#define TEST_SAMPLES 86400 // a day of samples at 1 s, a statistics window
+
+static int g_failed;
+
+#define CHECK(cond, format, ...)                                               \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            g_failed++;                                                        \
+            ESP_LOGE(TAG, "%s:%d " format, __func__, __LINE__, ##__VA_ARGS__); \
+        }                                                                      \
+    } while (0)
+
+//
+// the estimates of p50, p95 and p99 against the sorted samples. The error is a rank error: the fraction
+// of the samples below the estimate, against q. tolerance is the allowed rank error at p50, the tails
+// are more accurate with the k1 scale function and get a quarter of it.
+//
+static void CheckQuantiles(const char *name, std::vector<float> samples, float tolerance)
+{
+    static const float quantiles[] = { 0.5f, 0.95f, 0.99f };
+    TDigest digest;
+
+    for (float v : samples)
+        digest.Add(v);
+
+    std::sort(samples.begin(), samples.end());
+
+    CHECK(digest.Count() == samples.size(), "%s: count %u of %u", name, (unsigned)digest.Count(), (unsigned)samples.size());
+    CHECK(digest.Quantile(0) == samples.front() && digest.Min() == samples.front(), "%s: q=0 %g, min %g, expected %g", name, digest.Quantile(0),
+          digest.Min(), samples.front());
+    CHECK(digest.Quantile(1) == samples.back() && digest.Max() == samples.back(), "%s: q=1 %g, max %g, expected %g", name, digest.Quantile(1),
+          digest.Max(), samples.back());
+
+    printf("%-9s %6u samples:", name, (unsigned)samples.size());
+
+    for (float q : quantiles)
+    {
+        float estimate = digest.Quantile(q);
+        size_t below = std::lower_bound(samples.begin(), samples.end(), estimate) - samples.begin();
+        size_t upto = std::upper_bound(samples.begin(), samples.end(), estimate) - samples.begin();
+
+        // with duplicates any rank between below and upto is right
+        float rank = q * samples.size();
+        float error = (rank < below) ? (below - rank) : (rank > upto) ? (rank - upto) : 0;
+        float limit = (q == 0.5f) ? tolerance : tolerance / 4;
+
+        error /= samples.size();
+        printf("  p%-2d %9.3f (exact %9.3f, rank error %.4f)", (int)lroundf(q * 100), estimate, samples[(size_t)(q * (samples.size() - 1))], error);
+
+        CHECK(error <= limit, "%s: p%d %g, rank error %.4f > %.4f", name, (int)lroundf(q * 100), estimate, error, limit);
+        CHECK(estimate >= samples.front() && estimate <= samples.back(), "%s: p%d %g outside [min, max]", name, (int)lroundf(q * 100), estimate);
+    }
+    printf("\n");
+}
+
+static void TestDistributions(void)
+{
+    std::mt19937 rng(42);
+    std::vector<float> samples;
+
+    std::uniform_real_distribution<float> uniform(0, 5000);
+    for (uint32_t i = 0; i != TEST_SAMPLES; i++)
+        samples.push_back(uniform(rng));
+    CheckQuantiles("uniform", samples, 0.01f);
+
+    // night and day of the AC power: many samples around 0, the rest around 3 kW
+    std::normal_distribution<float> night(5, 2), day(3000, 400);
+    samples.clear();
+    for (uint32_t i = 0; i != TEST_SAMPLES; i++)
+        samples.push_back((i % 10 < 4) ? night(rng) : day(rng));
+    CheckQuantiles("bimodal", samples, 0.01f);
+
+    // the grid voltage in order, not shuffled: increasing samples are the worst case for the merge
+    samples.clear();
+    for (uint32_t i = 0; i != TEST_SAMPLES; i++)
+        samples.push_back(220 + 20.0f * i / TEST_SAMPLES);
+    CheckQuantiles("sorted", samples, 0.01f);
+
+    samples.assign(TEST_SAMPLES, 42.5f);
+    CheckQuantiles("constant", samples, 0);
+
+    // fewer samples than the buffer holds: all of them are merged when a quantile is asked for
+    samples.clear();
+    for (uint32_t i = 0; i != TDIGEST_BUFFER - 12; i++)
+        samples.push_back(uniform(rng));
+    CheckQuantiles("few", samples, 0.05f);
+}
+
+static void TestEmpty(void)
+{
+    TDigest digest;
+
+    CHECK(isnan(digest.Quantile(0.5f)) && isnan(digest.Min()) && isnan(digest.Max()) && isnan(digest.Mean()), "an empty digest is not NAN");
+
+    digest.Add(NAN);
+    CHECK(digest.Count() == 0, "NAN is counted");
+
+    digest.Add(7);
+    CHECK(digest.Quantile(0) == 7 && digest.Quantile(0.5f) == 7 && digest.Quantile(1) == 7 && digest.Mean() == 7, "a single sample");
+
+    digest.Reset();
+    CHECK(digest.Count() == 0 && isnan(digest.Quantile(0.5f)), "Reset()");
+}
+
+// the window must divide a day, the windows start at local midnight
+static void TestWindow(void)
+{
+    static const SEChannel_t channels[] = { CH_I_AC_Power };
+    Statistics stats(channels, 1);
+
+    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+    tzset();
+
+    CHECK(stats.GetWindow() == STATS_DEFAULT_WINDOW, "default window %u", (unsigned)stats.GetWindow());
+    CHECK(stats.SetWindow(7000) == ESP_ERR_INVALID_ARG && stats.GetWindow() == STATS_DEFAULT_WINDOW, "7000 s accepted");
+    CHECK(stats.SetWindow(0) == ESP_ERR_INVALID_ARG && stats.SetWindow(2 * 86400) == ESP_ERR_INVALID_ARG, "0 or two days accepted");
+    CHECK(stats.SetWindow(21600) == ESP_OK && stats.GetWindow() == 21600, "21600 s rejected");
+
+    // 2023-10-18 13:10 CEST: the window of 6 hours started at 12:00, the next one at 18:00
+    time_t midnight = 1697580000, now = midnight + 13 * 3600 + 600;
+
+    stats.Reset(now);
+    CHECK(stats.GetWindowStart() == midnight + 12 * 3600, "window start %lld", (long long)(stats.GetWindowStart() - midnight));
+    CHECK(!stats.WindowClosed(midnight + 18 * 3600 - 1) && stats.WindowClosed(midnight + 18 * 3600), "window end");
+}
+
+//
+// TDigest against the exact quantiles of known distributions, and the windows of Statistics
+//
+int main(void)
+{
+    TestDistributions();
+    TestEmpty();
+    TestWindow();
+
+    printf("%s\n", g_failed ? "FAILED" : "passed");
+
+    return g_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <esp_log.h>
+
+#include "Trace.h"
+#include "Channels.h"
+
+#define TAG "Trace"
+
+Trace::Trace()
+{
+    _samples = nullptr;
+    _count = 0;
+    _size = 0;
+}
+
+Trace::~Trace() { free(_samples); }
+
+SolarEdge_t *Trace::Append(void)
+{
+    if (_count == _size)
+    {
+        size_t size = _size ? _size * 2 : 1024;
+        SolarEdge_t *samples = (SolarEdge_t *)realloc(_samples, size * sizeof(SolarEdge_t));
+
+        if (!samples)
+            return nullptr;
+
+        _samples = samples;
+        _size = size;
+    }
+
+    SolarEdge_t *se = &_samples[_count++];
+    memset(se, 0, sizeof(*se));
+
+    return se;
+}
+
+// the next token ending at an unescaped separator, the escapes are removed
+static char *Token(char **p, char sep)
+{
+    char *start = *p, *out = *p;
+
+    while (**p && **p != sep)
+    {
+        if (**p == '\\' && (*p)[1])
+            (*p)++;
+        *out++ = *(*p)++;
+    }
+
+    if (**p)
+        (*p)++;
+    *out = '\0';
+
+    return start;
+}
+
+// <measurement>,serial=<serial> <field>=<value>,... <timestamp in ns>
+bool Trace::ParseLine(char *line, SolarEdge_t *se)
+{
+    char *p = line;
+    char *key = Token(&p, ' ');
+    char *fields = Token(&p, ' ');
+    char *timestamp = Token(&p, ' ');
+
+    if (!*fields || !*timestamp)
+        return false;
+
+    // the tags
+    Token(&key, ',');
+    while (*key)
+    {
+        char *tag = Token(&key, ',');
+        char *name = Token(&tag, '=');
+
+        if (strcmp(name, "serial") == 0)
+            strncpy((char *)se->C_SerialNumber, tag, sizeof(se->C_SerialNumber) - 1);
+    }
+
+    while (*fields)
+    {
+        char *value = Token(&fields, ',');
+        char *name = Token(&value, '=');
+        SEChannel_t ch = SE_ChannelByName(name);
+
+        if (ch != CH_MAX)
+            se->*SE_Channels[ch].Value = strtof(value, nullptr);
+        else if (strcmp(name, "I_Status") == 0)
+            se->I_Status = strtoul(value, nullptr, 10);
+        else if (strcmp(name, "I_Status_Vendor") == 0)
+            se->I_Status_Vendor = strtoul(value, nullptr, 10);
+    }
+
+    se->Timestamp = strtoll(timestamp, nullptr, 10) / 1000;
+    strcpy((char *)se->C_Model, "trace");
+
+    return se->Timestamp != 0;
+}
+
+esp_err_t Trace::Load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[2048];
+    uint32_t skipped = 0;
+
+    if (!f)
+        return ESP_ERR_NOT_FOUND;
+
+    while (fgets(line, sizeof(line), f))
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (!line[0] || line[0] == '#')
+            continue;
+
+        SolarEdge_t *se = Append();
+        if (!se)
+        {
+            fclose(f);
+            return ESP_ERR_NO_MEM;
+        }
+
+        // the samples must be in time order for the aggregators of the charts
+        if (!ParseLine(line, se) || (_count > 1 && se->Timestamp <= _samples[_count - 2].Timestamp))
+        {
+            _count--;
+            skipped++;
+        }
+    }
+
+    fclose(f);
+
+    ESP_LOGI(TAG, "%s: %u samples, %u lines skipped", path, (unsigned)_count, (unsigned)skipped);
+
+    return _count ? ESP_OK : ESP_ERR_INVALID_SIZE;
+}
+
+esp_err_t Trace::Synthesize(time_t start, uint32_t seconds, uint32_t interval)
+{
+    uint32_t seed = 12345;
+    double energy = 12345678, cloud = 1;
+
+    for (uint32_t t = 0; t < seconds; t += interval)
+    {
+        SolarEdge_t *se = Append();
+        if (!se)
+            return ESP_ERR_NO_MEM;
+
+        // the sun from 6:00 to 20:00, clouds drift in and out
+        double hour = (t % 86400) / 3600.0;
+        double sun = (hour > 6 && hour < 20) ? pow(sin(M_PI * (hour - 6) / 14), 1.5) : 0;
+
+        seed = seed * 1103515245 + 12345;
+        cloud += (((seed >> 16) & 0x7fff) / 32767.0 - 0.5) * 0.05;
+        cloud = (cloud < 0.3) ? 0.3 : (cloud > 1) ? 1 : cloud;
+
+        double power = 5000 * sun * cloud;
+        energy += power * interval / 3600;
+
+        se->Timestamp = (int64_t)(start + t) * 1000000LL;
+        strcpy((char *)se->C_Model, "synthetic");
+        strcpy((char *)se->C_Version, "0004.0018.0518");
+        strcpy((char *)se->C_SerialNumber, "7E0A1B2C");
+
+        se->I_AC_Power = power;
+        se->I_AC_VA = power;
+        se->I_AC_PF = 100;
+        se->I_AC_Energy_WH = floor(energy); // the counter of the inverter steps a Wh at a time
+        se->I_AC_Frequency = 50 + sin(t / 60.0) * 0.02;
+        se->I_AC_VoltageAN = 230 + sin(t / 300.0) * 3;
+        se->I_AC_VoltageBN = 231 + sin(t / 400.0) * 3;
+        se->I_AC_VoltageCN = 229 + sin(t / 500.0) * 3;
+        se->I_AC_CurrentA = power / 3 / se->I_AC_VoltageAN;
+        se->I_AC_CurrentB = power / 3 / se->I_AC_VoltageBN;
+        se->I_AC_CurrentC = power / 3 / se->I_AC_VoltageCN;
+        se->I_AC_Current = se->I_AC_CurrentA + se->I_AC_CurrentB + se->I_AC_CurrentC;
+        se->I_DC_Power = power ? power / 0.975 : 0;
+        se->I_DC_Voltage = power ? 750 : 0;
+        se->I_DC_Current = power ? se->I_DC_Power / se->I_DC_Voltage : 0;
+        se->I_Temp_Sink = 20 + power / 150;
+        se->I_Status = power ? 4 : 2; // producing, sleeping
+    }
+
+    return ESP_OK;
+}
+
+void Trace::Get(size_t i, SolarEdge_t *se) const
+{
+    size_t loop = i / _count;
+
+    *se = _samples[i % _count];
+
+    if (loop)
+    {
+        // one interval after the last sample
+        int64_t span = _samples[_count - 1].Timestamp - _samples[0].Timestamp;
+        int64_t step = (_count > 1) ? span / (_count - 1) : 1000000LL;
+
+        se->Timestamp += loop * (span + step);
+        // the lifetime counter does not go back
+        se->I_AC_Energy_WH += loop * (_samples[_count - 1].I_AC_Energy_WH - _samples[0].I_AC_Energy_WH);
+    }
+}
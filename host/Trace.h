@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stddef.h>
+#include <time.h>
+
+#include <esp_err.h>
+
+#include "sunspec.h"
+
+//
+// Samples to replay through the GUI: recorded in the InfluxDB line protocol of the gateway, e.g.
+//   nc -ul 8089 > trace.lp      with     influx -u udp://<host>:8089 -b 1
+// or a synthetic day. The fields are matched by channel name, unknown fields are ignored.
+//
+class Trace
+{
+public:
+    Trace();
+    ~Trace();
+
+    esp_err_t Load(const char *path);
+
+    // a sunny day with passing clouds, from midnight: the same samples on every run
+    esp_err_t Synthesize(time_t start, uint32_t seconds, uint32_t interval);
+
+    size_t GetCount(void) const { return _count; }
+
+    // sample i, past the end the trace is repeated with the timestamps moved forward
+    void Get(size_t i, SolarEdge_t *se) const;
+
+private:
+    SolarEdge_t *_samples;
+    size_t _count;
+    size_t _size;
+
+    SolarEdge_t *Append(void);
+    bool ParseLine(char *line, SolarEdge_t *se);
+};
@@ -0,0 +1,180 @@
+#include <string.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include <lvgl.h>
+
+#include "lcd.h"
+#include "HostDisplay.h"
+
+#define TAG "LCD"
+
+static uint16_t g_framebuffer[LCD_H_RES * LCD_V_RES];
+static lv_color_t g_draw_buf1[LCD_H_RES * CONFIG_SOLAREDGE_LCD_DRAW_LINES];
+static lv_color_t g_draw_buf2[LCD_H_RES * CONFIG_SOLAREDGE_LCD_DRAW_LINES];
+
+static lv_disp_t *g_disp;
+static LcdStats_t g_lcd_stats;
+static HostFrameStats_t g_frame; // counters of the refresh in progress
+
+static const char *DrawNames[HOST_DRAW_MAX] = { "rect", "arc", "img", "letter", "line", "polygon" };
+
+//
+// the draw callbacks of the software renderer, wrapped to count the calls
+//
+static struct
+{
+    void (*draw_rect)(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords);
+    void (*draw_arc)(lv_draw_ctx_t *draw_ctx, const lv_draw_arc_dsc_t *dsc, const lv_point_t *center, uint16_t radius, uint16_t start_angle,
+                     uint16_t end_angle);
+    void (*draw_img_decoded)(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc, const lv_area_t *coords, const uint8_t *map_p,
+                             lv_img_cf_t color_format);
+    void (*draw_letter)(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc, const lv_point_t *pos_p, uint32_t letter);
+    void (*draw_line)(lv_draw_ctx_t *draw_ctx, const lv_draw_line_dsc_t *dsc, const lv_point_t *point1, const lv_point_t *point2);
+    void (*draw_polygon)(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_point_t *points, uint16_t point_cnt);
+} g_sw;
+
+static void count_draw_rect(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords)
+{
+    g_frame.draw_calls[HOST_DRAW_RECT]++;
+    g_sw.draw_rect(draw_ctx, dsc, coords);
+}
+
+static void count_draw_arc(lv_draw_ctx_t *draw_ctx, const lv_draw_arc_dsc_t *dsc, const lv_point_t *center, uint16_t radius, uint16_t start_angle,
+                           uint16_t end_angle)
+{
+    g_frame.draw_calls[HOST_DRAW_ARC]++;
+    g_sw.draw_arc(draw_ctx, dsc, center, radius, start_angle, end_angle);
+}
+
+static void count_draw_img_decoded(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc, const lv_area_t *coords, const uint8_t *map_p,
+                                   lv_img_cf_t color_format)
+{
+    g_frame.draw_calls[HOST_DRAW_IMG]++;
+    g_sw.draw_img_decoded(draw_ctx, dsc, coords, map_p, color_format);
+}
+
+static void count_draw_letter(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc, const lv_point_t *pos_p, uint32_t letter)
+{
+    g_frame.draw_calls[HOST_DRAW_LETTER]++;
+    g_sw.draw_letter(draw_ctx, dsc, pos_p, letter);
+}
+
+static void count_draw_line(lv_draw_ctx_t *draw_ctx, const lv_draw_line_dsc_t *dsc, const lv_point_t *point1, const lv_point_t *point2)
+{
+    g_frame.draw_calls[HOST_DRAW_LINE]++;
+    g_sw.draw_line(draw_ctx, dsc, point1, point2);
+}
+
+static void count_draw_polygon(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_point_t *points, uint16_t point_cnt)
+{
+    g_frame.draw_calls[HOST_DRAW_POLYGON]++;
+    g_sw.draw_polygon(draw_ctx, dsc, points, point_cnt);
+}
+
+static void lcd_draw_ctx_init(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx)
+{
+    lv_draw_sw_init_ctx(drv, draw_ctx);
+
+    g_sw.draw_rect = draw_ctx->draw_rect;
+    g_sw.draw_arc = draw_ctx->draw_arc;
+    g_sw.draw_img_decoded = draw_ctx->draw_img_decoded;
+    g_sw.draw_letter = draw_ctx->draw_letter;
+    g_sw.draw_line = draw_ctx->draw_line;
+    g_sw.draw_polygon = draw_ctx->draw_polygon;
+
+    draw_ctx->draw_rect = count_draw_rect;
+    draw_ctx->draw_arc = count_draw_arc;
+    draw_ctx->draw_img_decoded = count_draw_img_decoded;
+    draw_ctx->draw_letter = count_draw_letter;
+    draw_ctx->draw_line = count_draw_line;
+    draw_ctx->draw_polygon = count_draw_polygon;
+}
+
+static void lcd_lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    int64_t start = esp_timer_get_time();
+    size_t width = lv_area_get_width(area);
+
+    for (lv_coord_t y = area->y1; y <= area->y2; y++)
+    {
+        memcpy(&g_framebuffer[y * LCD_H_RES + area->x1], color_map, width * sizeof(uint16_t));
+        color_map += width;
+    }
+
+    g_frame.flushes++;
+    g_lcd_stats.flush_us += esp_timer_get_time() - start;
+    lv_disp_flush_ready(drv);
+}
+
+static void lcd_lvgl_monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px)
+{
+    g_frame.frames++;
+    g_frame.pixels += px;
+
+    g_lcd_stats.frames++;
+    g_lcd_stats.render_ms += time;
+    g_lcd_stats.pixels += px;
+}
+
+esp_err_t LCDInit(void)
+{
+    static lv_disp_draw_buf_t disp_buf;
+    static lv_disp_drv_t disp_drv;
+
+    ESP_LOGI(TAG, "Initialize LVGL library");
+    lv_init();
+
+    lv_disp_draw_buf_init(&disp_buf, g_draw_buf1, g_draw_buf2, LCD_H_RES * CONFIG_SOLAREDGE_LCD_DRAW_LINES);
+
+    ESP_LOGI(TAG, "Register display driver to LVGL, %d lines per draw buffer", CONFIG_SOLAREDGE_LCD_DRAW_LINES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = LCD_H_RES;
+    disp_drv.ver_res = LCD_V_RES;
+    disp_drv.flush_cb = lcd_lvgl_flush_cb;
+    disp_drv.monitor_cb = lcd_lvgl_monitor_cb;
+    disp_drv.draw_ctx_init = lcd_draw_ctx_init;
+    disp_drv.draw_buf = &disp_buf;
+
+    g_disp = lv_disp_drv_register(&disp_drv);
+
+    return g_disp ? ESP_OK : ESP_FAIL;
+}
+
+void HostDisplayRefresh(HostFrameStats_t *stats)
+{
+    memset(&g_frame, 0, sizeof(g_frame));
+
+    int64_t start = esp_timer_get_time();
+    lv_refr_now(g_disp);
+    g_frame.render_us = esp_timer_get_time() - start;
+
+    stats->frames += g_frame.frames;
+    stats->render_us += g_frame.render_us;
+    stats->pixels += g_frame.pixels;
+    stats->flushes += g_frame.flushes;
+    for (int i = 0; i != HOST_DRAW_MAX; i++)
+        stats->draw_calls[i] += g_frame.draw_calls[i];
+}
+
+const uint16_t *HostDisplayFramebuffer(void) { return g_framebuffer; }
+
+const char *HostDrawName(HostDraw_t draw) { return (draw < HOST_DRAW_MAX) ? DrawNames[draw] : "unknown"; }
+
+void LCDGetStats(LcdStats_t *stats) { *stats = g_lcd_stats; }
+
+// the screen is never turned off on the host
+void LCDSetActive(bool active) { (void)active; }
+
+// there is no touch on the host, the harness toggles the panels itself
+void LCDSetWakeCallback(void (*cb)(void *ctx), void *ctx)
+{
+    (void)cb;
+    (void)ctx;
+}
+
+// the harness drives LVGL from the thread that changes the widgets
+void lvgl_acquire(void) {}
+
+void lvgl_release(void) {}
@@ -0,0 +1,16 @@
+#pragma once
+
+//
+// The configuration of the firmware (main/lv_conf.h), with what a 64 bit host needs on top of it.
+//
+#include "../main/lv_conf.h"
+
+// pointers take twice the space of the ESP32
+#undef LV_MEM_SIZE
+#define LV_MEM_SIZE (128U * 1024U)
+
+// fail the run instead of hanging in a loop
+#undef LV_ASSERT_HANDLER_INCLUDE
+#undef LV_ASSERT_HANDLER
+#define LV_ASSERT_HANDLER_INCLUDE <stdlib.h>
+#define LV_ASSERT_HANDLER abort();
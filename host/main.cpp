@@ -0,0 +1,277 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include "lcd.h"
+#include "gui.h"
+#include "Energy.h"
+#include "Channels.h"
+#include "HostDisplay.h"
+#include "Png.h"
+#include "Trace.h"
+
+#define TAG "bench"
+
+#define BENCH_DEFAULT_FRAMES 100
+
+// the synthetic trace: from midnight (2023-10-18, CEST) to 15:00, a sample per second
+#define BENCH_SYNTH_START    1697580000
+#define BENCH_SYNTH_SECONDS  (15 * 3600)
+#define BENCH_SYNTH_INTERVAL 1
+
+static const char *PanelNames[PANEL_MAX] = {
+    "chart_1h",
+    "chart_24h",
+    "gauge",
+#if CONFIG_SOLAREDGE_LCD_BENCHMARK
+    "bench",
+#endif
+};
+
+typedef struct
+{
+    HostFrameStats_t show;   // the refresh right after the panel was switched to
+    HostFrameStats_t frames; // the refreshes after the replayed samples
+    uint32_t samples;
+    uint64_t update_us; // GUI_UpdatePanels() and GUI_SetStatus()
+    uint64_t max_render_us;
+} PanelStats_t;
+
+typedef struct
+{
+    GuiData_t gui;
+    EnergyIntegrator energy;
+    SolarEdge_t se;
+    int mday;
+} Replay_t;
+
+//
+// the GUI asks time() for the tick labels and the status line: it gets the time of the sample
+// being replayed (linked with --wrap=time)
+//
+static time_t g_now;
+
+extern "C" time_t __wrap_time(time_t *t)
+{
+    if (t)
+        *t = g_now;
+    return g_now;
+}
+
+// a sample, as TaskModbus and the main loop prepare it for the GUI
+static void Feed(Replay_t *replay, const Trace *trace, size_t i)
+{
+    SolarEdge_t *se = &replay->se;
+    float last_24h = se->I_AC_Energy_WH_Last24H;
+    float last_24h_frac = se->I_AC_Energy_WH_Last24H_Frac;
+
+    trace->Get(i, se);
+    g_now = se->Timestamp / 1000000;
+
+    replay->energy.Add(se->Timestamp, se->I_AC_Power, se->I_DC_Power, se->I_AC_Energy_WH);
+    se->I_AC_Energy_WH_Frac = replay->energy.GetOffset();
+    se->I_DC_AC_Efficiency = replay->energy.GetEfficiency();
+
+    replay->gui.agg_Power_1H->Add(g_now, se);
+    replay->gui.agg_Power_24H->Add(g_now, se);
+
+    // the counter at midnight
+    struct tm ltm;
+    localtime_r(&g_now, &ltm);
+    se->I_AC_Energy_WH_Last24H = last_24h;
+    se->I_AC_Energy_WH_Last24H_Frac = last_24h_frac;
+    if (ltm.tm_mday != replay->mday)
+    {
+        replay->mday = ltm.tm_mday;
+        SE_SetMidnight(se);
+    }
+}
+
+static uint64_t Update(Replay_t *replay)
+{
+    int64_t start = esp_timer_get_time();
+
+    GUI_UpdatePanels(&replay->gui, &replay->se);
+    GUI_SetStatus(&replay->gui, GUI_STATE_TIME);
+
+    return esp_timer_get_time() - start;
+}
+
+static void PrintFrames(const char *name, uint32_t count, const HostFrameStats_t *stats, const PanelStats_t *panel)
+{
+    uint32_t n = count ? count : 1;
+
+    printf("%-10s %6u %6u", name, (unsigned)count, (unsigned)stats->frames);
+    if (panel)
+        printf(" %9.1f", (double)panel->update_us / n);
+    else
+        printf(" %9s", "-");
+    printf(" %9.1f", (double)stats->render_us / n);
+    if (panel)
+        printf(" %9u", (unsigned)panel->max_render_us);
+    else
+        printf(" %9s", "-");
+    printf(" %9.0f %7.2f", (double)stats->pixels / n, (double)stats->flushes / n);
+    for (int i = 0; i != HOST_DRAW_MAX; i++)
+        printf(" %8.1f", (double)stats->draw_calls[i] / n);
+    printf("\n");
+}
+
+static void PrintHeader(void)
+{
+    printf("%-10s %6s %6s %9s %9s %9s %9s %7s", "panel", "n", "frames", "update_us", "render_us", "max_us", "px", "flushes");
+    for (int i = 0; i != HOST_DRAW_MAX; i++)
+        printf(" %8s", HostDrawName((HostDraw_t)i));
+    printf("\n");
+}
+
+static void Snapshot(const char *dir, const char *name)
+{
+    char path[512];
+
+    snprintf(path, sizeof(path), "%s/%s.png", dir, name);
+    if (PngWrite(path, HostDisplayFramebuffer(), LCD_H_RES, LCD_V_RES) != ESP_OK)
+        ESP_LOGE(TAG, "PngWrite(%s) failed", path);
+}
+
+static void Usage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [-t trace.lp] [-n frames] [-o snapshot-dir]\n"
+            "  -t  replay a trace in the InfluxDB line protocol of the gateway, default: a synthetic day\n"
+            "  -n  samples (and frames) per panel, default %d. The samples before are replayed without rendering\n"
+            "  -o  write a png of every panel after its frames, and of the first frame\n",
+            name, BENCH_DEFAULT_FRAMES);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *trace_path = nullptr, *snapshot_dir = nullptr;
+    uint32_t frames = BENCH_DEFAULT_FRAMES;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:n:o:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 't':
+                trace_path = optarg;
+                break;
+            case 'n':
+                frames = strtoul(optarg, nullptr, 10);
+                break;
+            case 'o':
+                snapshot_dir = optarg;
+                break;
+            default:
+                Usage(argv[0]);
+                return 1;
+        }
+    }
+
+    // the time zone of the gateway, unless the environment has one
+    setenv("TZ", "CET-1CEST,M3.5.0/02:00:00,M10.5.0/02:00:00", 0);
+    tzset();
+
+    static Trace trace;
+    esp_err_t err = trace_path ? trace.Load(trace_path) : trace.Synthesize(BENCH_SYNTH_START, BENCH_SYNTH_SECONDS, BENCH_SYNTH_INTERVAL);
+    if (err != ESP_OK || frames == 0)
+    {
+        ESP_LOGE(TAG, "no samples to replay");
+        return 1;
+    }
+
+    static Replay_t replay;
+    static bool ntp_synced = true;
+    size_t total = (size_t)frames * PANEL_MAX;
+    size_t warmup = (trace.GetCount() > total) ? trace.GetCount() - total : 0;
+
+    // the first sample sets the clock before anything is shown
+    replay.mday = -1;
+    replay.gui.BackLightActive = 30;
+    replay.gui.ntp_synced = &ntp_synced;
+    SolarEdge_t first;
+    trace.Get(0, &first);
+    g_now = first.Timestamp / 1000000;
+
+    ESP_ERROR_CHECK(LCDInit());
+
+    int64_t start = esp_timer_get_time();
+    GUI_Setup(&replay.gui);
+    int64_t setup_us = esp_timer_get_time() - start;
+
+    HostFrameStats_t setup = {};
+    HostDisplayRefresh(&setup);
+    if (snapshot_dir)
+        Snapshot(snapshot_dir, "setup");
+
+    // fill the charts, LVGL only renders once afterwards
+    start = esp_timer_get_time();
+    for (size_t i = 0; i != warmup; i++)
+    {
+        Feed(&replay, &trace, i);
+        Update(&replay);
+    }
+    int64_t warmup_us = esp_timer_get_time() - start;
+
+    HostFrameStats_t settle = {};
+    HostDisplayRefresh(&settle);
+
+    printf("GUI_Setup %lld us, first frame %llu us %llu px; %u samples replayed without rendering in %lld us\n\n", (long long)setup_us,
+           (unsigned long long)setup.render_us, (unsigned long long)setup.pixels, (unsigned)warmup, (long long)warmup_us);
+
+    PanelStats_t stats[PANEL_MAX] = {};
+    size_t next = warmup;
+
+    for (uint8_t p = 0; p != PANEL_MAX; p++)
+    {
+        PanelStats_t *panel = &stats[p];
+
+        while (replay.gui.ActivePanel != p)
+            GUI_TogglePanel(&replay.gui);
+        HostDisplayRefresh(&panel->show);
+
+        for (uint32_t f = 0; f != frames; f++)
+        {
+            HostFrameStats_t frame = {};
+
+            Feed(&replay, &trace, next++);
+            panel->update_us += Update(&replay);
+            panel->samples++;
+
+            HostDisplayRefresh(&frame);
+
+            panel->frames.frames += frame.frames;
+            panel->frames.render_us += frame.render_us;
+            panel->frames.pixels += frame.pixels;
+            panel->frames.flushes += frame.flushes;
+            for (int i = 0; i != HOST_DRAW_MAX; i++)
+                panel->frames.draw_calls[i] += frame.draw_calls[i];
+            if (frame.render_us > panel->max_render_us)
+                panel->max_render_us = frame.render_us;
+        }
+
+        if (snapshot_dir)
+            Snapshot(snapshot_dir, PanelNames[p]);
+    }
+
+    // per sample; the switch to a panel is a single refresh
+    PrintHeader();
+    for (uint8_t p = 0; p != PANEL_MAX; p++)
+        PrintFrames(PanelNames[p], stats[p].samples, &stats[p].frames, &stats[p]);
+
+    printf("\nswitching to a panel:\n");
+    PrintHeader();
+    for (uint8_t p = 0; p != PANEL_MAX; p++)
+        PrintFrames(PanelNames[p], 1, &stats[p].show, nullptr);
+
+    return 0;
+}
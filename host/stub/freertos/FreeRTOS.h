@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+//
+// Just the types and the calls the modules built on the host make. The GUI runs in a single thread,
+// the sender task of the influx sink is a thread (task.h).
+//
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE         1
+#define pdFALSE        0
+#define pdPASS         pdTRUE
+#define pdFAIL         pdFALSE
+#define portMAX_DELAY  ((TickType_t)0xffffffff)
+
+#define configTICK_RATE_HZ       1000
+#define configMINIMAL_STACK_SIZE 2048
+#define pdMS_TO_TICKS(ms)        ((TickType_t)(ms) * configTICK_RATE_HZ / 1000)
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "FreeRTOS.h"
+
+//
+// A task is a thread on the host, its notification a counting semaphore. Tasks never end.
+//
+typedef void (*TaskFunction_t)(void *);
+
+typedef struct HostTask
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t notified;
+    TaskFunction_t function;
+    void *param;
+} *TaskHandle_t;
+
+static inline TaskHandle_t *HostCurrentTask(void)
+{
+    static thread_local TaskHandle_t task;
+    return &task;
+}
+
+static inline void *HostTaskStart(void *arg)
+{
+    TaskHandle_t task = (TaskHandle_t)arg;
+
+    *HostCurrentTask() = task;
+    task->function(task->param);
+
+    return nullptr;
+}
+
+static inline BaseType_t xTaskCreate(TaskFunction_t function, const char *name, uint32_t stack, void *param, UBaseType_t priority, TaskHandle_t *created)
+{
+    TaskHandle_t task = (TaskHandle_t)calloc(1, sizeof(*task));
+
+    (void)name;
+    (void)stack;
+    (void)priority;
+
+    if (!task)
+        return pdFAIL;
+
+    pthread_mutex_init(&task->lock, nullptr);
+    pthread_cond_init(&task->cond, nullptr);
+    task->function = function;
+    task->param = param;
+
+    if (pthread_create(&task->thread, nullptr, HostTaskStart, task) != 0)
+    {
+        free(task);
+        return pdFAIL;
+    }
+    pthread_detach(task->thread);
+
+    if (created)
+        *created = task;
+
+    return pdPASS;
+}
+
+static inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->lock);
+    task->notified++;
+    pthread_cond_signal(&task->cond);
+    pthread_mutex_unlock(&task->lock);
+
+    return pdPASS;
+}
+
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    TaskHandle_t task = *HostCurrentTask();
+    struct timespec until;
+    uint32_t count;
+
+    clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_sec += ticks / configTICK_RATE_HZ;
+    until.tv_nsec += (long)(ticks % configTICK_RATE_HZ) * (1000000000L / configTICK_RATE_HZ);
+    if (until.tv_nsec >= 1000000000L)
+    {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&task->lock);
+    while (task->notified == 0 && pthread_cond_timedwait(&task->cond, &task->lock, &until) != ETIMEDOUT)
+        ;
+
+    count = task->notified;
+    if (count)
+        task->notified = clear ? 0 : count - 1;
+    pthread_mutex_unlock(&task->lock);
+
+    return count;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+//
+// The configuration of the host build: the display with the default pipeline of the ESP32-S3 build.
+//
+#define CONFIG_SOLAREDGE_USE_LCD             1
+#define CONFIG_SOLAREDGE_LCD_PIPELINE_BOUNCE 1
+#define CONFIG_SOLAREDGE_LCD_BOUNCE_LINES    10
+#define CONFIG_SOLAREDGE_LCD_DRAW_LINES      20
@@ -0,0 +1,70 @@
+#include "Aggregator.h"
+
+IntervalAggregator::IntervalAggregator(uint32_t interval, float SolarEdge_t::*channel)
+{
+    _interval = interval ? interval : 1;
+    _channel = channel;
+
+    _start = 0;
+    _sum = 0;
+    _min = 0;
+    _max = 0;
+    _count = 0;
+    _dropped = 0;
+}
+
+void IntervalAggregator::Close(void)
+{
+    Bucket_t b;
+
+    b.start = _start;
+    b.count = _count;
+    b.mean = _count ? _sum / _count : 0;
+    b.min = _min;
+    b.max = _max;
+
+    if (!_queue.Push(b))
+        _dropped++;
+
+    _sum = 0;
+    _min = 0;
+    _max = 0;
+    _count = 0;
+}
+
+void IntervalAggregator::Add(time_t now, const SolarEdge_t *se)
+{
+    time_t start = now - (now % _interval);
+    float value = se->*_channel;
+
+    if (_count && start != _start)
+    {
+        time_t missing = (start - _start) / (time_t)_interval - 1;
+
+        Close();
+
+        // emit empty buckets for intervals without any samples, keeps the charts aligned in time.
+        // Larger (or negative) gaps are clock steps, e.g. the first NTP sync, not lost samples.
+        if (missing > 0 && missing <= AGGREGATOR_QUEUE_SIZE)
+        {
+            for (_start += _interval; _start < start; _start += _interval)
+                Close();
+        }
+    }
+
+    _start = start;
+
+    if (_count == 0 || value < _min)
+        _min = value;
+    if (_count == 0 || value > _max)
+        _max = value;
+
+    _sum += value;
+    _count++;
+}
+
+bool IntervalAggregator::Pop(Bucket_t *bucket) { return _queue.Pop(bucket); }
+
+uint32_t IntervalAggregator::GetInterval(void) const { return _interval; }
+
+uint32_t IntervalAggregator::GetDropped(void) const { return _dropped; }
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+#include "sunspec.h"
+#include "SpscQueue.h"
+
+// number of closed buckets that can wait for the consumer
+#define AGGREGATOR_QUEUE_SIZE 16
+
+typedef struct
+{
+    time_t start;   // start of the bucket, aligned to a multiple of the interval
+    float mean;     // exact mean of all samples in the bucket
+    float min;      // smallest sample in the bucket
+    float max;      // largest sample in the bucket
+    uint32_t count; // number of samples, 0 for a bucket without data (connection lost)
+} Bucket_t;
+
+//
+// Accumulates every sample of a single SolarEdge_t channel into time aligned buckets.
+// Closed buckets are handed to the consumer through a lock free queue, so the producer (modbus task)
+// never waits for the consumer (gui) and no bucket is skipped while the consumer is busy.
+//
+class IntervalAggregator
+{
+public:
+    IntervalAggregator(uint32_t interval, float SolarEdge_t::*channel);
+
+    // producer: add the channel value of a new sample
+    void Add(time_t now, const SolarEdge_t *se);
+
+    // consumer: get the oldest closed bucket, returns false when none is available
+    bool Pop(Bucket_t *bucket);
+
+    uint32_t GetInterval(void) const;
+    uint32_t GetDropped(void) const;
+
+private:
+    uint32_t _interval;
+    float SolarEdge_t::*_channel;
+
+    time_t _start;
+    float _sum;
+    float _min;
+    float _max;
+    uint32_t _count;
+    uint32_t _dropped;
+
+    SpscQueue<Bucket_t, AGGREGATOR_QUEUE_SIZE> _queue;
+
+    void Close(void);
+};
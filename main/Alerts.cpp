@@ -0,0 +1,173 @@
+#include <math.h>
+
+#include "Alerts.h"
+
+//
+// EN 50160: 230 V +/- 10%, 50 Hz +/- 0.2 Hz (well within the +/- 1% for 99.5% of a year).
+// SolarEdge inverters derate above a heat sink temperature of about 80 °C.
+//
+const AlertRule_t AlertDefaultRules[] = {
+    { "over_temperature", CH_I_Temp_Sink, ALERT_ABOVE, 75.0f, 70.0f, 30 },
+    { "over_voltage_a", CH_I_AC_VoltageAN, ALERT_ABOVE, 253.0f, 250.0f, 10 },
+    { "over_voltage_b", CH_I_AC_VoltageBN, ALERT_ABOVE, 253.0f, 250.0f, 10 },
+    { "over_voltage_c", CH_I_AC_VoltageCN, ALERT_ABOVE, 253.0f, 250.0f, 10 },
+    { "under_voltage_a", CH_I_AC_VoltageAN, ALERT_BELOW, 207.0f, 210.0f, 10 },
+    { "under_voltage_b", CH_I_AC_VoltageBN, ALERT_BELOW, 207.0f, 210.0f, 10 },
+    { "under_voltage_c", CH_I_AC_VoltageCN, ALERT_BELOW, 207.0f, 210.0f, 10 },
+    { "over_frequency", CH_I_AC_Frequency, ALERT_ABOVE, 50.2f, 50.1f, 5 },
+    { "under_frequency", CH_I_AC_Frequency, ALERT_BELOW, 49.8f, 49.9f, 5 },
+    { "current_imbalance", ALERT_SRC_CURRENT_IMBALANCE, ALERT_ABOVE, 20.0f, 15.0f, 60 },
+    { "fault", ALERT_SRC_STATUS, ALERT_EQUAL, 7.0f, 7.0f, 0 },
+};
+
+const uint8_t AlertNumDefaultRules = sizeof(AlertDefaultRules) / sizeof(AlertDefaultRules[0]);
+
+// imbalance is only meaningful with some current flowing
+#define IMBALANCE_MIN_CURRENT 1.0f
+
+// phases of the inverter: 101 single, 102 split and 103 three phase. Before the common block was read: all
+static uint8_t NumPhases(uint16_t did)
+{
+    if (did == 101)
+        return 1;
+    if (did == 102)
+        return 2;
+
+    return 3;
+}
+
+// the phase a source belongs to, 0 for all other sources
+static uint8_t SourcePhase(int source)
+{
+    switch (source)
+    {
+        case CH_I_AC_CurrentA:
+        case CH_I_AC_VoltageAN:
+            return 1;
+
+        case CH_I_AC_CurrentB:
+        case CH_I_AC_VoltageBN:
+            return 2;
+
+        case CH_I_AC_CurrentC:
+        case CH_I_AC_VoltageCN:
+            return 3;
+
+        default:
+            return 0;
+    }
+}
+
+AlertEngine::AlertEngine() { _num_rules = 0; }
+
+esp_err_t AlertEngine::Compile(const AlertRule_t *rules, uint8_t num_rules)
+{
+    if (num_rules > ALERTS_MAX_RULES)
+        return ESP_ERR_INVALID_SIZE;
+
+    for (uint8_t i = 0; i != num_rules; i++)
+    {
+        if (rules[i].Source < 0 || rules[i].Source >= ALERT_SRC_MAX)
+            return ESP_ERR_INVALID_ARG;
+
+        Compiled_t &r = _rules[i];
+
+        r.name = rules[i].Name;
+        r.source = (uint8_t)rules[i].Source;
+        r.phase = SourcePhase(rules[i].Source);
+        r.condition = (uint8_t)rules[i].Condition;
+        r.set = rules[i].Set;
+        r.clear = rules[i].Clear;
+        r.min_duration = (int64_t)rules[i].MinDuration * 1000000LL;
+        r.active = false;
+        r.pending = false;
+        r.since = 0;
+    }
+
+    _num_rules = num_rules;
+
+    return ESP_OK;
+}
+
+uint8_t AlertEngine::Evaluate(const SolarEdge_t *se, AlertEvent_t *events, uint8_t max_events)
+{
+    float values[ALERT_SRC_MAX];
+    uint8_t num_events = 0;
+
+    for (int ch = 0; ch != CH_MAX; ch++)
+        values[ch] = se->*SE_Channels[ch].Value;
+
+    // the phases an inverter does not have read 0, they are left out
+    uint8_t phases = NumPhases(se->C_SunSpec_Phase);
+    const float currents[3] = { se->I_AC_CurrentA, se->I_AC_CurrentB, se->I_AC_CurrentC };
+    float imin = currents[0], imax = currents[0], imean = currents[0];
+
+    for (uint8_t p = 1; p < phases; p++)
+    {
+        imin = fminf(imin, currents[p]);
+        imax = fmaxf(imax, currents[p]);
+        imean += currents[p];
+    }
+    imean /= phases;
+
+    values[ALERT_SRC_CURRENT_IMBALANCE] = (phases > 1 && imean >= IMBALANCE_MIN_CURRENT) ? 100.0f * (imax - imin) / imean : 0;
+    values[ALERT_SRC_STATUS] = se->I_Status;
+
+    for (uint8_t i = 0; i != _num_rules; i++)
+    {
+        Compiled_t &r = _rules[i];
+        float v = values[r.source];
+        bool raise;
+
+        if (r.phase > phases)
+        {
+            r.pending = false;
+            continue;
+        }
+
+        // an active alert is kept until the clear threshold is passed
+        switch (r.condition)
+        {
+            case ALERT_ABOVE:
+                raise = r.active ? (v >= r.clear) : (v > r.set);
+                break;
+
+            case ALERT_BELOW:
+                raise = r.active ? (v <= r.clear) : (v < r.set);
+                break;
+
+            default:
+                raise = (v == r.set);
+                break;
+        }
+
+        if (raise == r.active)
+        {
+            r.pending = false;
+            continue;
+        }
+
+        if (!r.pending)
+        {
+            r.pending = true;
+            r.since = se->Timestamp;
+        }
+
+        if (se->Timestamp - r.since >= r.min_duration)
+        {
+            r.active = raise;
+            r.pending = false;
+
+            if (num_events < max_events)
+                events[num_events++] = { r.name, raise, v, se->Timestamp };
+        }
+    }
+
+    return num_events;
+}
+
+uint8_t AlertEngine::GetNumRules(void) const { return _num_rules; }
+
+const char *AlertEngine::GetName(uint8_t i) const { return _rules[i].name; }
+
+bool AlertEngine::IsActive(uint8_t i) const { return _rules[i].active; }
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <esp_err.h>
+
+#include "sunspec.h"
+#include "Channels.h"
+
+#define ALERTS_MAX_RULES 16
+
+// alert sources beyond the SolarEdge_t channels, derived from a sample
+typedef enum {
+    ALERT_SRC_CURRENT_IMBALANCE = CH_MAX, // % (max - min) / mean of the phase currents
+    ALERT_SRC_STATUS,                     // I_Status
+    ALERT_SRC_MAX
+} AlertSource_t;
+
+typedef enum { ALERT_ABOVE, ALERT_BELOW, ALERT_EQUAL } AlertCondition_t;
+
+typedef struct
+{
+    const char *Name;           // published as <topic>/alert/<name>
+    int Source;                 // SEChannel_t or AlertSource_t
+    AlertCondition_t Condition; // compare the source with Set
+    float Set;                  // threshold to raise the alert
+    float Clear;                // threshold to clear the alert again (hysteresis), unused for ALERT_EQUAL
+    uint32_t MinDuration;       // seconds a condition must hold before the alert changes state
+} AlertRule_t;
+
+typedef struct
+{
+    const char *Name;
+    bool Active;
+    float Value;
+    int64_t Timestamp; // capture time of the sample that changed the state, microseconds since epoch
+} AlertEvent_t;
+
+// default rules, thresholds can be changed with the 'alert' console command
+extern const AlertRule_t AlertDefaultRules[];
+extern const uint8_t AlertNumDefaultRules;
+
+//
+// Evaluates all rules for every sample with hysteresis and a minimum duration (debounce).
+// Rules are compiled once into a flat table, evaluation is a single loop without allocation.
+// Rules on a phase the inverter does not have (C_SunSpec_Phase) are skipped.
+//
+class AlertEngine
+{
+public:
+    AlertEngine();
+
+    esp_err_t Compile(const AlertRule_t *rules, uint8_t num_rules);
+
+    // evaluate all rules, returns the number of alerts that changed state (stored in events)
+    uint8_t Evaluate(const SolarEdge_t *se, AlertEvent_t *events, uint8_t max_events);
+
+    uint8_t GetNumRules(void) const;
+    const char *GetName(uint8_t i) const;
+    bool IsActive(uint8_t i) const;
+
+private:
+    typedef struct
+    {
+        const char *name;
+        uint8_t source;
+        uint8_t phase; // 1..3: the rule is skipped when the inverter has fewer phases
+        uint8_t condition;
+        bool active;
+        bool pending;
+        float set;
+        float clear;
+        int64_t min_duration; // us
+        int64_t since;        // us, start of a pending change
+    } Compiled_t;
+
+    Compiled_t _rules[ALERTS_MAX_RULES];
+    uint8_t _num_rules;
+};
@@ -0,0 +1,51 @@
+#include "Batch.h"
+#include "TextWriter.h"
+
+SampleBatch::SampleBatch() { Reset(); }
+
+void SampleBatch::Reset(void) { _count = 0; }
+
+void SampleBatch::Add(const SolarEdge_t *se)
+{
+    if (_count == BATCH_MAX_SAMPLES)
+        return;
+
+    _time[_count] = se->Timestamp;
+    for (int ch = 0; ch != CH_MAX; ch++)
+        _values[ch][_count] = SE_ChannelValue(se, (SEChannel_t)ch);
+    _status[_count] = se->I_Status;
+
+    _count++;
+}
+
+size_t SampleBatch::Serialize(char *buf, size_t size) const
+{
+    TextWriter out(buf, size);
+
+    if (_count == 0)
+        return 0;
+
+    out.Printf("{\"t0\":%lld,\"dt\":[", (long long)(_time[0] / 1000));
+    for (uint16_t i = 0; i != _count; i++)
+        out.Printf(i ? ",%lld" : "%lld", i ? (long long)(_time[i] / 1000 - _time[i - 1] / 1000) : 0LL);
+    out.Printf("]");
+
+    for (int ch = 0; ch != CH_MAX; ch++)
+    {
+        out.Printf(",\"%s\":[", SE_Channels[ch].Name);
+        for (uint16_t i = 0; i != _count; i++)
+        {
+            if (i)
+                out.Printf(",");
+            out.Number(_values[ch][i]);
+        }
+        out.Printf("]");
+    }
+
+    out.Printf(",\"I_Status\":[");
+    for (uint16_t i = 0; i != _count; i++)
+        out.Printf(i ? ",%u" : "%u", (unsigned)_status[i]);
+    out.Printf("]}");
+
+    return out.Overflow() ? 0 : out.Length();
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sunspec.h"
+#include "Channels.h"
+
+// bound of the buffer, a batch is flushed when it is full (or when the oldest sample is too old)
+#define BATCH_MAX_SAMPLES 30
+
+// 30 samples of all channels serialize to about 5 KB
+#define BATCH_MAX_SIZE 8192
+
+//
+// All samples since the last publish, stored per channel (columnar) and serialized as:
+//
+//  {"t0":<ms since epoch of the first sample>,"dt":[0,1000,1001,..],"I_AC_Current":[..],..,"I_Status":[..]}
+//
+// dt holds the milliseconds since the previous sample, t0 + the running sum of dt is the capture time.
+//
+class SampleBatch
+{
+public:
+    SampleBatch();
+
+    void Reset(void);
+    void Add(const SolarEdge_t *se);
+
+    uint16_t GetCount(void) const { return _count; }
+    bool Full(void) const { return _count == BATCH_MAX_SAMPLES; }
+
+    // age of the oldest sample in microseconds, relative to the capture time 'now' (SolarEdge_t::Timestamp)
+    int64_t GetLatency(int64_t now) const { return _count ? now - _time[0] : 0; }
+
+    // returns the length of the json document, or 0 when the buffer is too small
+    size_t Serialize(char *buf, size_t size) const;
+
+private:
+    int64_t _time[BATCH_MAX_SAMPLES];
+    float _values[CH_MAX][BATCH_MAX_SAMPLES];
+    uint16_t _status[BATCH_MAX_SAMPLES];
+    uint16_t _count;
+};
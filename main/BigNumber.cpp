@@ -0,0 +1,165 @@
+#include <string.h>
+
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+
+#include "BigNumber.h"
+
+#define TAG "BigNumber"
+
+GlyphAtlas::GlyphAtlas()
+{
+    _count = 0;
+    _line_height = 0;
+    _digit_width = 0;
+}
+
+esp_err_t GlyphAtlas::Init(const lv_font_t *font, lv_color_t color, const char *letters)
+{
+    size_t total = 0;
+
+    _line_height = lv_font_get_line_height(font);
+
+    for (const char *p = letters; *p && _count != GLYPH_ATLAS_MAX_GLYPHS; p++)
+    {
+        GlyphCell_t *cell = &_cells[_count];
+        lv_font_glyph_dsc_t g;
+
+        if (!lv_font_get_glyph_dsc(font, &g, *p, 0))
+            continue;
+
+        cell->letter = *p;
+        cell->adv = g.adv_w;
+        cell->ofs_x = g.ofs_x;
+        // the same baseline as lv_draw_letter()
+        cell->ofs_y = (font->line_height - font->base_line) - g.box_h - g.ofs_y;
+        memset(&cell->img, 0, sizeof(cell->img));
+        _count++;
+
+        if (*p >= '0' && *p <= '9' && g.adv_w > _digit_width)
+            _digit_width = g.adv_w;
+
+        const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, *p);
+        if (!bitmap || g.box_w == 0 || g.box_h == 0)
+            continue; // a space
+
+        size_t size = (size_t)g.box_w * g.box_h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        uint8_t *px = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        if (!px)
+            px = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        if (!px)
+            return ESP_ERR_NO_MEM;
+
+        // the bitmap is packed without padding between the rows, the most significant bits first
+        uint32_t max = (1 << g.bpp) - 1;
+        for (uint32_t i = 0; i != (uint32_t)g.box_w * g.box_h; i++)
+        {
+            uint32_t bit = i * g.bpp;
+            uint32_t value = (bitmap[bit >> 3] >> (8 - g.bpp - (bit & 7))) & max;
+
+            px[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 0] = color.full & 0xFF;
+            px[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 1] = color.full >> 8;
+            px[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 2] = value * LV_OPA_COVER / max;
+        }
+
+        cell->img.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+        cell->img.header.w = g.box_w;
+        cell->img.header.h = g.box_h;
+        cell->img.data_size = size;
+        cell->img.data = px;
+
+        total += size;
+    }
+
+    ESP_LOGI(TAG, "%u glyphs, %u bytes", _count, (unsigned)total);
+
+    return ESP_OK;
+}
+
+const GlyphCell_t *GlyphAtlas::Find(uint32_t letter) const
+{
+    for (uint8_t i = 0; i != _count; i++)
+    {
+        if (_cells[i].letter == letter)
+            return &_cells[i];
+    }
+
+    return nullptr;
+}
+
+BigNumber::BigNumber()
+{
+    _obj = nullptr;
+    _atlas = nullptr;
+}
+
+int16_t BigNumber::Advance(uint32_t letter, const void *ctx)
+{
+    const GlyphCell_t *cell = ((const GlyphAtlas *)ctx)->Find(letter);
+
+    return cell ? cell->adv : 0;
+}
+
+lv_obj_t *BigNumber::Create(lv_obj_t *parent, const GlyphAtlas *atlas, uint8_t max_chars, bool fixed)
+{
+    _atlas = atlas;
+
+    if (max_chars > BIG_NUMBER_MAX_CHARS)
+        max_chars = BIG_NUMBER_MAX_CHARS;
+
+    _obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(_obj);
+    lv_obj_clear_flag(_obj, (lv_obj_flag_t)(LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE));
+    lv_coord_t w = max_chars * atlas->GetDigitWidth();
+    lv_obj_set_size(_obj, w, atlas->GetLineHeight());
+    lv_obj_add_event_cb(_obj, DrawEvent, LV_EVENT_DRAW_MAIN, this);
+
+    // not the width of the object, its layout is only updated before the next refresh
+    _cells.Init(w, atlas->GetDigitWidth(), fixed, Advance, atlas);
+
+    return _obj;
+}
+
+void BigNumber::InvalidateColumns(int16_t x1, int16_t x2, void *ctx)
+{
+    lv_obj_t *obj = ((BigNumber *)ctx)->_obj;
+
+    // a glyph may reach a little into the next cell
+    lv_area_t area = { (lv_coord_t)(obj->coords.x1 + x1 - 2), obj->coords.y1, (lv_coord_t)(obj->coords.x1 + x2 + 1), obj->coords.y2 };
+
+    lv_obj_invalidate_area(obj, &area);
+}
+
+void BigNumber::SetText(const char *text) { _cells.SetText(text, InvalidateColumns, this); }
+
+void BigNumber::Draw(lv_draw_ctx_t *draw_ctx)
+{
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+
+    for (uint8_t i = 0; i != _cells.GetCount(); i++)
+    {
+        const GlyphCell_t *cell = _atlas->Find(_cells.GetLetter(i));
+        lv_coord_t x1 = _cells.GetX(i), x2 = _cells.GetX(i + 1);
+
+        if (!cell || !cell->img.data)
+            continue;
+
+        // centered in a widened cell
+        lv_coord_t x = _obj->coords.x1 + x1 + cell->ofs_x + ((x2 - x1) - cell->adv) / 2;
+        lv_coord_t y = _obj->coords.y1 + cell->ofs_y;
+        lv_area_t area = { x, y, (lv_coord_t)(x + cell->img.header.w - 1), (lv_coord_t)(y + cell->img.header.h - 1) };
+        lv_area_t clip;
+
+        // only the cells in the invalidated area
+        if (_lv_area_intersect(&clip, draw_ctx->clip_area, &area))
+            lv_draw_img(draw_ctx, &dsc, &area, &cell->img);
+    }
+}
+
+void BigNumber::DrawEvent(lv_event_t *e)
+{
+    BigNumber *number = (BigNumber *)lv_event_get_user_data(e);
+
+    number->Draw(lv_event_get_draw_ctx(e));
+}
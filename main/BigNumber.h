@@ -0,0 +1,70 @@
+#pragma once
+
+#include <esp_err.h>
+
+#include <lvgl.h>
+
+#include "BigNumberCells.h"
+
+#define GLYPH_ATLAS_MAX_GLYPHS 24
+
+typedef struct
+{
+    uint32_t letter;
+    lv_coord_t adv;   // advance to the next cell
+    lv_coord_t ofs_x; // position of the bitmap in the cell
+    lv_coord_t ofs_y; // from the top of the line
+    lv_img_dsc_t img; // TRUE_COLOR_ALPHA, in the colour of the atlas
+} GlyphCell_t;
+
+//
+// The glyphs of a font rendered once into RAM, in one colour: digits, units and punctuation.
+// Drawing a glyph is an image blit, the font engine does not unpack it again.
+//
+class GlyphAtlas
+{
+public:
+    GlyphAtlas();
+
+    esp_err_t Init(const lv_font_t *font, lv_color_t color, const char *letters);
+
+    // nullptr for a letter that is not in the atlas
+    const GlyphCell_t *Find(uint32_t letter) const;
+
+    lv_coord_t GetLineHeight(void) const { return _line_height; }
+    lv_coord_t GetDigitWidth(void) const { return _digit_width; }
+
+private:
+    GlyphCell_t _cells[GLYPH_ATLAS_MAX_GLYPHS];
+    uint8_t _count;
+    lv_coord_t _line_height;
+    lv_coord_t _digit_width; // the widest digit
+};
+
+//
+// A big value drawn from a GlyphAtlas. Setting the text only invalidates the cells that changed (BigNumberCells),
+// with fixed set the digits all take the width of the widest one and the value does not jitter.
+// The text is centered in a box of max_chars cells.
+//
+class BigNumber
+{
+public:
+    BigNumber();
+
+    lv_obj_t *Create(lv_obj_t *parent, const GlyphAtlas *atlas, uint8_t max_chars, bool fixed);
+
+    void SetText(const char *text);
+
+    lv_obj_t *GetObj(void) { return _obj; }
+
+private:
+    lv_obj_t *_obj;
+    const GlyphAtlas *_atlas;
+    BigNumberCells _cells;
+
+    void Draw(lv_draw_ctx_t *draw_ctx);
+
+    static int16_t Advance(uint32_t letter, const void *ctx);
+    static void InvalidateColumns(int16_t x1, int16_t x2, void *ctx);
+    static void DrawEvent(lv_event_t *e);
+};
@@ -0,0 +1,85 @@
+#include <string.h>
+
+#include "BigNumberCells.h"
+
+BigNumberCells::BigNumberCells()
+{
+    _advance = nullptr;
+    _ctx = nullptr;
+    _w = 0;
+    _digit_width = 0;
+    _fixed = false;
+    _text[0] = '\0';
+    _x[0] = 0;
+    _n = 0;
+}
+
+void BigNumberCells::Init(int16_t width, int16_t digit_width, bool fixed, Advance_t advance, const void *ctx)
+{
+    _w = width;
+    _digit_width = digit_width;
+    _fixed = fixed;
+    _advance = advance;
+    _ctx = ctx;
+    _text[0] = '\0';
+    _x[0] = 0;
+    _n = 0;
+}
+
+// the cells of text, centered in the box. Returns the number of cells
+uint8_t BigNumberCells::Layout(const char *text, int16_t *x) const
+{
+    uint8_t n = 0;
+
+    x[0] = 0;
+    for (; text[n] && n != BIG_NUMBER_MAX_CHARS; n++)
+    {
+        int16_t adv = _advance ? _advance((uint8_t)text[n], _ctx) : 0;
+
+        if (_fixed && text[n] >= '0' && text[n] <= '9')
+            adv = _digit_width;
+
+        x[n + 1] = x[n] + adv;
+    }
+
+    int16_t ofs = (_w - x[n]) / 2;
+    for (uint8_t i = 0; i <= n; i++)
+        x[i] += ofs;
+
+    return n;
+}
+
+uint8_t BigNumberCells::SetText(const char *text, Invalidate_t invalidate, void *ctx)
+{
+    if (strncmp(text, _text, BIG_NUMBER_MAX_CHARS) == 0)
+        return 0;
+
+    int16_t x[BIG_NUMBER_MAX_CHARS + 1];
+    uint8_t n = Layout(text, x);
+    uint8_t cells = (n > _n) ? n : _n;
+    uint8_t redrawn = 0;
+
+    for (uint8_t i = 0; i != cells; i++)
+    {
+        bool in_old = i < _n, in_new = i < n;
+
+        if (in_old && in_new && text[i] == _text[i] && x[i] == _x[i] && x[i + 1] == _x[i + 1])
+            continue;
+
+        if (in_old && in_new)
+            invalidate((x[i] < _x[i]) ? x[i] : _x[i], (x[i + 1] > _x[i + 1]) ? x[i + 1] : _x[i + 1], ctx);
+        else if (in_old)
+            invalidate(_x[i], _x[i + 1], ctx);
+        else
+            invalidate(x[i], x[i + 1], ctx);
+
+        redrawn++;
+    }
+
+    memcpy(_text, text, n);
+    _text[n] = '\0';
+    memcpy(_x, x, sizeof(x[0]) * (n + 1));
+    _n = n;
+
+    return redrawn;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+#define BIG_NUMBER_MAX_CHARS 12
+
+//
+// The character cells of a BigNumber, without LVGL: where every character is, centered in a box, and after a new
+// text which columns must be redrawn. A cell is redrawn when its letter or its place changed, in the old and the
+// new place. With fixed set the digits all take the width of the widest one.
+//
+class BigNumberCells
+{
+public:
+    // advance of a letter, 0 for a letter that is not drawn
+    typedef int16_t (*Advance_t)(uint32_t letter, const void *ctx);
+
+    // the columns [x1, x2) of the box must be redrawn
+    typedef void (*Invalidate_t)(int16_t x1, int16_t x2, void *ctx);
+
+    BigNumberCells();
+
+    void Init(int16_t width, int16_t digit_width, bool fixed, Advance_t advance, const void *ctx);
+
+    // returns the number of cells redrawn, 0 when the text did not change
+    uint8_t SetText(const char *text, Invalidate_t invalidate, void *ctx);
+
+    uint8_t GetCount(void) const { return _n; }
+    char GetLetter(uint8_t i) const { return _text[i]; }
+
+    // start of cell i relative to the box, GetX(GetCount()) is the end of the text
+    int16_t GetX(uint8_t i) const { return _x[i]; }
+
+private:
+    Advance_t _advance;
+    const void *_ctx;
+    int16_t _w;
+    int16_t _digit_width;
+    bool _fixed;
+
+    char _text[BIG_NUMBER_MAX_CHARS + 1];
+    int16_t _x[BIG_NUMBER_MAX_CHARS + 1];
+    uint8_t _n;
+
+    uint8_t Layout(const char *text, int16_t *x) const;
+};
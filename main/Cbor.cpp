@@ -0,0 +1,101 @@
+#include <string.h>
+
+#include "Cbor.h"
+
+#define CBOR_UINT  0
+#define CBOR_NINT  1
+#define CBOR_TEXT  3
+#define CBOR_ARRAY 4
+#define CBOR_MAP   5
+#define CBOR_FLOAT 0xfa // major type 7, 32 bit IEEE 754
+
+CborWriter::CborWriter(uint8_t *buf, size_t size)
+{
+    _buf = buf;
+    _size = size;
+    _len = 0;
+    _overflow = false;
+}
+
+void CborWriter::Put(uint8_t byte)
+{
+    if (_len < _size)
+        _buf[_len++] = byte;
+    else
+        _overflow = true;
+}
+
+void CborWriter::Head(uint8_t major, uint64_t value)
+{
+    uint8_t mt = major << 5;
+    int bytes;
+
+    if (value < 24)
+    {
+        Put(mt | (uint8_t)value);
+        return;
+    }
+    else if (value <= UINT8_MAX)
+    {
+        Put(mt | 24);
+        bytes = 1;
+    }
+    else if (value <= UINT16_MAX)
+    {
+        Put(mt | 25);
+        bytes = 2;
+    }
+    else if (value <= UINT32_MAX)
+    {
+        Put(mt | 26);
+        bytes = 4;
+    }
+    else
+    {
+        Put(mt | 27);
+        bytes = 8;
+    }
+
+    while (bytes--)
+        Put((uint8_t)(value >> (8 * bytes)));
+}
+
+void CborWriter::Uint(uint64_t value) { Head(CBOR_UINT, value); }
+
+void CborWriter::Int(int64_t value)
+{
+    if (value >= 0)
+        Head(CBOR_UINT, (uint64_t)value);
+    else
+        Head(CBOR_NINT, (uint64_t)(-1 - value));
+}
+
+void CborWriter::Float(float value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    Put(CBOR_FLOAT);
+    Put((uint8_t)(bits >> 24));
+    Put((uint8_t)(bits >> 16));
+    Put((uint8_t)(bits >> 8));
+    Put((uint8_t)bits);
+}
+
+void CborWriter::Text(const char *str)
+{
+    size_t n = strlen(str);
+
+    Head(CBOR_TEXT, n);
+    while (n--)
+        Put((uint8_t)*str++);
+}
+
+void CborWriter::Array(size_t items) { Head(CBOR_ARRAY, items); }
+
+void CborWriter::Map(size_t pairs) { Head(CBOR_MAP, pairs); }
+
+size_t CborWriter::Length(void) const { return _len; }
+
+bool CborWriter::Overflow(void) const { return _overflow; }
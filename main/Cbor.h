@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+//
+// Minimal CBOR (RFC 8949) encoder writing into a caller supplied buffer, no allocation.
+// Only the major types needed for telemetry: unsigned/negative integers, float32, text strings, arrays and maps.
+//
+class CborWriter
+{
+public:
+    CborWriter(uint8_t *buf, size_t size);
+
+    void Uint(uint64_t value);
+    void Int(int64_t value);
+    void Float(float value);
+    void Text(const char *str);
+    void Array(size_t items);
+    void Map(size_t pairs);
+
+    size_t Length(void) const;
+    bool Overflow(void) const;
+
+private:
+    uint8_t *_buf;
+    size_t _size;
+    size_t _len;
+    bool _overflow;
+
+    void Head(uint8_t major, uint64_t value);
+    void Put(uint8_t byte);
+};
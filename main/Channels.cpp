@@ -0,0 +1,38 @@
+#include <string.h>
+
+#include "Channels.h"
+
+const SEChannelInfo_t SE_Channels[CH_MAX] = {
+    { "I_AC_Current", "A", &SolarEdge_t::I_AC_Current },
+    { "I_AC_CurrentA", "A", &SolarEdge_t::I_AC_CurrentA },
+    { "I_AC_CurrentB", "A", &SolarEdge_t::I_AC_CurrentB },
+    { "I_AC_CurrentC", "A", &SolarEdge_t::I_AC_CurrentC },
+    { "I_AC_VoltageAB", "V", &SolarEdge_t::I_AC_VoltageAB },
+    { "I_AC_VoltageBC", "V", &SolarEdge_t::I_AC_VoltageBC },
+    { "I_AC_VoltageCA", "V", &SolarEdge_t::I_AC_VoltageCA },
+    { "I_AC_VoltageAN", "V", &SolarEdge_t::I_AC_VoltageAN },
+    { "I_AC_VoltageBN", "V", &SolarEdge_t::I_AC_VoltageBN },
+    { "I_AC_VoltageCN", "V", &SolarEdge_t::I_AC_VoltageCN },
+    { "I_AC_Power", "W", &SolarEdge_t::I_AC_Power },
+    { "I_AC_Frequency", "Hz", &SolarEdge_t::I_AC_Frequency },
+    { "I_AC_VA", "VA", &SolarEdge_t::I_AC_VA },
+    { "I_AC_VAR", "var", &SolarEdge_t::I_AC_VAR },
+    { "I_AC_PF", "%", &SolarEdge_t::I_AC_PF },
+    { "I_AC_Energy_WH", "Wh", &SolarEdge_t::I_AC_Energy_WH },
+    { "I_DC_Current", "A", &SolarEdge_t::I_DC_Current },
+    { "I_DC_Voltage", "V", &SolarEdge_t::I_DC_Voltage },
+    { "I_DC_Power", "W", &SolarEdge_t::I_DC_Power },
+    { "I_DC_AC_Efficiency", "%", &SolarEdge_t::I_DC_AC_Efficiency },
+    { "I_Temp_Sink", "°C", &SolarEdge_t::I_Temp_Sink },
+};
+
+SEChannel_t SE_ChannelByName(const char *name)
+{
+    for (int i = 0; i != CH_MAX; i++)
+    {
+        if (strcmp(SE_Channels[i].Name, name) == 0)
+            return (SEChannel_t)i;
+    }
+
+    return CH_MAX;
+}
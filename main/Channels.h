@@ -0,0 +1,60 @@
+#pragma once
+
+#include "sunspec.h"
+
+//
+// All numeric channels of SolarEdge_t, in the order of the json document.
+//
+typedef enum {
+    CH_I_AC_Current = 0,
+    CH_I_AC_CurrentA,
+    CH_I_AC_CurrentB,
+    CH_I_AC_CurrentC,
+    CH_I_AC_VoltageAB,
+    CH_I_AC_VoltageBC,
+    CH_I_AC_VoltageCA,
+    CH_I_AC_VoltageAN,
+    CH_I_AC_VoltageBN,
+    CH_I_AC_VoltageCN,
+    CH_I_AC_Power,
+    CH_I_AC_Frequency,
+    CH_I_AC_VA,
+    CH_I_AC_VAR,
+    CH_I_AC_PF,
+    CH_I_AC_Energy_WH,
+    CH_I_DC_Current,
+    CH_I_DC_Voltage,
+    CH_I_DC_Power,
+    CH_I_DC_AC_Efficiency,
+    CH_I_Temp_Sink,
+    CH_MAX
+} SEChannel_t;
+
+typedef struct
+{
+    const char *Name;            // key in the json document
+    const char *Unit;            // unit of measurement
+    float SolarEdge_t::*Value;   // the value in SolarEdge_t
+} SEChannelInfo_t;
+
+extern const SEChannelInfo_t SE_Channels[CH_MAX];
+
+// value of a channel for a sample
+static inline float SE_ChannelValue(const SolarEdge_t *se, SEChannel_t ch) { return se->*SE_Channels[ch].Value; }
+
+// production since midnight, see SE_SetMidnight(). Counters and fractions are subtracted separately,
+// a lifetime counter of 10 MWh leaves a float no bits below 1 Wh
+static inline float SE_EnergyToday(const SolarEdge_t *se)
+{
+    return (se->I_AC_Energy_WH - se->I_AC_Energy_WH_Last24H) + (se->I_AC_Energy_WH_Frac - se->I_AC_Energy_WH_Last24H_Frac);
+}
+
+// remember the lifetime energy at midnight
+static inline void SE_SetMidnight(SolarEdge_t *se)
+{
+    se->I_AC_Energy_WH_Last24H = se->I_AC_Energy_WH;
+    se->I_AC_Energy_WH_Last24H_Frac = se->I_AC_Energy_WH_Frac;
+}
+
+// find a channel by name, returns CH_MAX when not found
+SEChannel_t SE_ChannelByName(const char *name);
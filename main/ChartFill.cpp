@@ -0,0 +1,253 @@
+#include <string.h>
+
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+
+#include "ChartFill.h"
+
+#define TAG "ChartFill"
+
+ChartFill::ChartFill()
+{
+    _chart = nullptr;
+    _series = nullptr;
+    _buf = nullptr;
+    _alpha = nullptr;
+    _appended = 0;
+    _head = 0;
+    _drawn = false;
+}
+
+esp_err_t ChartFill::Init(lv_obj_t *chart, lv_chart_series_t *series, lv_coord_t ymin, lv_coord_t ymax, lv_opa_t opa)
+{
+    lv_obj_update_layout(chart);
+
+    _chart = chart;
+    _series = series;
+    _color = series->color;
+    _opa = opa;
+    _ymin = ymin;
+    _ymax = (ymax != ymin) ? ymax : ymin + 1;
+
+    // the same geometry as the line series of lv_chart
+    lv_coord_t border = lv_obj_get_style_border_width(chart, LV_PART_MAIN);
+    _x_ofs = lv_obj_get_style_pad_left(chart, LV_PART_MAIN) + border;
+    _y_ofs = lv_obj_get_style_pad_top(chart, LV_PART_MAIN) + border;
+    _w = lv_obj_get_content_width(chart);
+    _h = lv_obj_get_content_height(chart);
+
+    // down to the bottom of the chart, like the original fill
+    lv_coord_t width = _w + 1;
+    lv_coord_t height = lv_obj_get_height(chart) - _y_ofs;
+
+    if (width <= 1 || height <= 1)
+        return ESP_ERR_INVALID_SIZE;
+
+    size_t size = (size_t)width * height * LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    _buf = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    _alpha = (uint8_t *)heap_caps_malloc(height, MALLOC_CAP_SPIRAM);
+
+    if (!_buf || !_alpha)
+    {
+        ESP_LOGW(TAG, "no memory for %u bytes, the area is drawn with masks", (unsigned)size);
+        heap_caps_free(_buf);
+        heap_caps_free(_alpha);
+        _buf = _alpha = nullptr;
+        return ESP_ERR_NO_MEM;
+    }
+
+    // opaque at the top 1/8 of the chart, fading to 40% at the bottom. The colour never changes, only the alpha bytes are written later
+    lv_coord_t top = lv_obj_get_height(chart) / 8 - _y_ofs;
+    for (lv_coord_t r = 0; r != height; r++)
+    {
+        uint32_t mask = (r <= top) ? LV_OPA_COVER : LV_OPA_COVER - (uint32_t)(LV_OPA_COVER - LV_OPA_40) * (r - top) / (height - 1 - top);
+        _alpha[r] = (uint32_t)opa * mask / LV_OPA_COVER;
+    }
+
+    for (size_t i = 0; i != (size_t)width * height; i++)
+    {
+        _buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 0] = _color.full & 0xFF;
+        _buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 1] = _color.full >> 8;
+        _buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 2] = LV_OPA_TRANSP;
+    }
+
+    memset(&_img, 0, sizeof(_img));
+    _img.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    _img.header.w = width;
+    _img.header.h = height;
+    _img.data_size = size;
+    _img.data = _buf;
+
+    Rebuild();
+
+    return ESP_OK;
+}
+
+lv_coord_t ChartFill::PointX(uint16_t i) const { return ((int32_t)_w * i) / (lv_chart_get_point_count(_chart) - 1); }
+
+lv_coord_t ChartFill::PointY(lv_coord_t value) const { return _h - ((int32_t)(value - _ymin) * _h) / (_ymax - _ymin); }
+
+//
+// render the columns [from, to) as they are shown now, every column is the area below the line at that x
+//
+void ChartFill::RenderColumns(lv_coord_t from, lv_coord_t to)
+{
+    const lv_coord_t *y_points = lv_chart_get_y_array(_chart, _series);
+    uint16_t start = lv_chart_get_x_start_point(_chart, _series);
+    uint16_t count = lv_chart_get_point_count(_chart);
+    lv_coord_t width = _img.header.w;
+    lv_coord_t height = _img.header.h;
+
+    if (count < 2)
+        return;
+
+    for (lv_coord_t c = from; c < to; c++)
+    {
+        // the segment of the line covering this column
+        uint16_t i = ((int32_t)c * (count - 1)) / _w;
+        if (i > count - 2)
+            i = count - 2;
+        while (i < count - 2 && PointX(i + 1) < c)
+            i++;
+        while (i > 0 && PointX(i) > c)
+            i--;
+
+        lv_coord_t v0 = y_points[(start + i) % count];
+        lv_coord_t v1 = y_points[(start + i + 1) % count];
+        lv_coord_t top = height;
+
+        if (v0 != LV_CHART_POINT_NONE && v1 != LV_CHART_POINT_NONE)
+        {
+            lv_coord_t x0 = PointX(i), x1 = PointX(i + 1);
+            lv_coord_t y0 = PointY(v0), y1 = PointY(v1);
+
+            top = (x1 > x0) ? y0 + ((int32_t)(y1 - y0) * (c - x0)) / (x1 - x0) : y0;
+            top = LV_CLAMP(0, top, height);
+        }
+
+        uint8_t *px = _buf + ((c + _head) % width) * LV_IMG_PX_SIZE_ALPHA_BYTE + 2;
+        for (lv_coord_t r = 0; r != height; r++, px += width * LV_IMG_PX_SIZE_ALPHA_BYTE)
+            *px = (r >= top) ? _alpha[r] : LV_OPA_TRANSP;
+    }
+}
+
+void ChartFill::Rebuild(void)
+{
+    if (!_buf)
+        return;
+
+    _appended = 0;
+    _head = 0;
+
+    RenderColumns(0, _img.header.w);
+}
+
+void ChartFill::Append(void)
+{
+    if (!_buf)
+        return;
+
+    // the line moves left by the width of a point, the ring follows it exactly: shift = appended * _w / (count - 1)
+    uint16_t count = lv_chart_get_point_count(_chart);
+    lv_coord_t width = _img.header.w;
+    uint64_t before = (uint64_t)_appended * _w / (count - 1);
+    uint64_t after = (uint64_t)++_appended * _w / (count - 1);
+    lv_coord_t shift = (after - before < (uint64_t)width) ? after - before : width;
+
+    _head = after % width;
+
+    // the points are not on whole columns, the scrolled columns are off by up to one. The first column may still
+    // show the segment of the point that left the chart, the column before the new ones joins the new segment
+    RenderColumns(0, 1);
+    RenderColumns((shift < width) ? width - shift - 1 : 0, width);
+}
+
+void ChartFill::Blit(lv_draw_ctx_t *draw_ctx)
+{
+    lv_coord_t width = _img.header.w;
+    lv_coord_t x0 = _chart->coords.x1 + _x_ofs;
+    lv_coord_t y0 = _chart->coords.y1 + _y_ofs;
+    lv_coord_t y1 = y0 + _img.header.h - 1;
+    const lv_area_t *clip_area = draw_ctx->clip_area;
+
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+
+    // image column _head is shown at x0, the columns left of it follow on the right
+    for (int part = 0; part != 2; part++)
+    {
+        lv_coord_t x = part ? x0 + width - _head : x0 - _head;
+        lv_area_t area = { x, y0, (lv_coord_t)(x + width - 1), y1 };
+        lv_area_t shown = { part ? x : x0, y0, part ? (lv_coord_t)(x0 + width - 1) : (lv_coord_t)(x0 + width - _head - 1), y1 };
+        lv_area_t clip;
+
+        if (shown.x2 < shown.x1 || !_lv_area_intersect(&clip, clip_area, &shown))
+            continue;
+
+        draw_ctx->clip_area = &clip;
+        lv_draw_img(draw_ctx, &dsc, &area, &_img);
+    }
+
+    draw_ctx->clip_area = clip_area;
+}
+
+//
+// the area below a line segment of the series, with a line mask and a fade mask: the fill of the chart without the
+// image. Slower, every segment covers the full height below it
+//
+void ChartFill::DrawMasked(lv_obj_draw_part_dsc_t *dsc)
+{
+    if (!dsc->p1 || !dsc->p2 || dsc->sub_part_ptr != _series)
+        return;
+
+    lv_draw_mask_line_param_t line_mask_param;
+    lv_draw_mask_line_points_init(&line_mask_param, dsc->p1->x, dsc->p1->y, dsc->p2->x, dsc->p2->y, LV_DRAW_MASK_LINE_SIDE_BOTTOM);
+    int16_t line_mask_id = lv_draw_mask_add(&line_mask_param, NULL);
+
+    lv_draw_mask_fade_param_t fade_mask_param;
+    lv_draw_mask_fade_init(&fade_mask_param, &_chart->coords, LV_OPA_COVER, _chart->coords.y1 + lv_obj_get_height(_chart) / 8, LV_OPA_40,
+        _chart->coords.y2);
+    int16_t fade_mask_id = lv_draw_mask_add(&fade_mask_param, NULL);
+
+    lv_draw_rect_dsc_t draw_rect_dsc;
+    lv_draw_rect_dsc_init(&draw_rect_dsc);
+    draw_rect_dsc.bg_opa = _opa;
+    draw_rect_dsc.bg_color = _color;
+
+    lv_area_t a;
+    a.x1 = dsc->p1->x;
+    a.x2 = dsc->p2->x - 1;
+    a.y1 = LV_MIN(dsc->p1->y, dsc->p2->y);
+    a.y2 = _chart->coords.y2;
+    lv_draw_rect(dsc->draw_ctx, &draw_rect_dsc, &a);
+
+    lv_draw_mask_free_param(&line_mask_param);
+    lv_draw_mask_free_param(&fade_mask_param);
+    lv_draw_mask_remove_id(line_mask_id);
+    lv_draw_mask_remove_id(fade_mask_id);
+}
+
+void ChartFill::DrawEvent(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_DRAW_MAIN_BEGIN)
+        _drawn = false;
+    else if (code == LV_EVENT_DRAW_PART_BEGIN && _chart)
+    {
+        lv_obj_draw_part_dsc_t *dsc = (lv_obj_draw_part_dsc_t *)lv_event_get_param(e);
+
+        if (dsc->part != LV_PART_ITEMS)
+            return;
+
+        if (!_buf)
+            DrawMasked(dsc);
+        else if (!_drawn)
+        {
+            // below all lines
+            Blit(dsc->draw_ctx);
+            _drawn = true;
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <esp_err.h>
+
+#include <lvgl.h>
+
+//
+// The faded area below a line series, rendered in an off-screen image instead of a line and fade mask per segment.
+//
+// The image is a ring of columns: when a point is appended to the series, the ring scrolls by the width of a
+// point and only the new columns on the right are rendered, O(height). Drawing the chart is one (or two, where
+// the ring wraps) image blits. The image takes 3 bytes per pixel of the chart from PSRAM, about 0.6 MB for a
+// chart of the display. When that is not available, the area is drawn with a line and fade mask per segment.
+//
+class ChartFill
+{
+public:
+    ChartFill();
+
+    // updates the layout of the chart, the series must use LV_CHART_UPDATE_MODE_SHIFT. ymin/ymax: the range of the y axis.
+    // Returns ESP_ERR_NO_MEM when the image could not be allocated, DrawEvent() then draws the area with masks
+    esp_err_t Init(lv_obj_t *chart, lv_chart_series_t *series, lv_coord_t ymin, lv_coord_t ymax, lv_opa_t opa);
+
+    // a point was appended to the series, the chart is not invalidated
+    void Append(void);
+
+    // render all columns again, e.g. after the range of the chart changed
+    void Rebuild(void);
+
+    // from LV_EVENT_DRAW_MAIN_BEGIN and LV_EVENT_DRAW_PART_BEGIN of the chart:
+    // blits the area once per draw pass, before the first line segment. Without the image: below every segment
+    void DrawEvent(lv_event_t *e);
+
+private:
+    lv_obj_t *_chart;
+    lv_chart_series_t *_series;
+    lv_color_t _color;
+    lv_opa_t _opa;
+
+    lv_img_dsc_t _img;
+    uint8_t *_buf;
+    uint8_t *_alpha; // opacity of every row, the fade towards the bottom
+
+    lv_coord_t _x_ofs; // first column, relative to the chart
+    lv_coord_t _y_ofs; // first row, relative to the chart
+    lv_coord_t _w;     // width of the series, the last point is at _x_ofs + _w
+    lv_coord_t _h;     // height of the series, the value range maps to rows 0.._h
+    lv_coord_t _ymin;
+    lv_coord_t _ymax;
+
+    uint32_t _appended; // points appended since Rebuild()
+    lv_coord_t _head;   // column of the image shown at _x_ofs
+    bool _drawn;        // drawn in the current draw pass
+
+    lv_coord_t PointX(uint16_t i) const;
+    lv_coord_t PointY(lv_coord_t value) const;
+    void RenderColumns(lv_coord_t from, lv_coord_t to);
+    void Blit(lv_draw_ctx_t *draw_ctx);
+    void DrawMasked(lv_obj_draw_part_dsc_t *dsc);
+};
@@ -0,0 +1,100 @@
+#include <string.h>
+
+#include <cJSON.h>
+
+#include "Commands.h"
+
+static const char *CommandNames[CMD_MAX] = { "poll", "frequency", "format", "deadband", "burst", "stats", "save" };
+
+const char *CommandName(CommandType_t type) { return type < CMD_MAX ? CommandNames[type] : "unknown"; }
+
+static bool GetNumber(cJSON *jsDOC, const char *name, double *value)
+{
+    cJSON *item = cJSON_GetObjectItem(jsDOC, name);
+
+    if (!cJSON_IsNumber(item))
+        return false;
+
+    *value = item->valuedouble;
+    return true;
+}
+
+static bool ParseArguments(cJSON *jsDOC, Command_t *cmd)
+{
+    double value;
+
+    switch (cmd->Type)
+    {
+        case CMD_POLL:
+        case CMD_FREQUENCY:
+        case CMD_BURST:
+            if (!GetNumber(jsDOC, "value", &value))
+                return false;
+
+            cmd->Value = (int32_t)value;
+            return true;
+
+        case CMD_FORMAT:
+        {
+            const char *formats = cJSON_GetStringValue(cJSON_GetObjectItem(jsDOC, "value"));
+            if (!formats)
+                return false;
+
+            strlcpy(cmd->Arg, formats, sizeof(cmd->Arg));
+            return true;
+        }
+
+        case CMD_DEADBAND:
+        {
+            const char *channel = cJSON_GetStringValue(cJSON_GetObjectItem(jsDOC, "channel"));
+            if (!channel || !GetNumber(jsDOC, "absolute", &value))
+                return false;
+
+            strlcpy(cmd->Arg, channel, sizeof(cmd->Arg));
+            cmd->Deadband.Absolute = value;
+            cmd->Deadband.Relative = GetNumber(jsDOC, "relative", &value) ? value / 100.0 : 0;
+            cmd->Deadband.MaxAge = GetNumber(jsDOC, "max_age", &value) ? (uint32_t)value : DEADBAND_DEFAULT_MAX_AGE;
+            return true;
+        }
+
+        default:
+            return true;
+    }
+}
+
+esp_err_t CommandParse(const char *payload, size_t len, Command_t *cmd)
+{
+    esp_err_t err = ESP_ERR_INVALID_ARG;
+    double value;
+
+    memset(cmd, 0, sizeof(Command_t));
+    cmd->Type = CMD_UNKNOWN;
+    cmd->Id = -1;
+
+    cJSON *jsDOC = cJSON_ParseWithLength(payload, len);
+    if (!jsDOC)
+        return ESP_ERR_INVALID_ARG;
+
+    if (GetNumber(jsDOC, "id", &value))
+        cmd->Id = (int32_t)value;
+
+    const char *name = cJSON_GetStringValue(cJSON_GetObjectItem(jsDOC, "cmd"));
+    if (name)
+        strlcpy(cmd->Name, name, sizeof(cmd->Name));
+
+    for (int type = 0; name && type != CMD_MAX; type++)
+    {
+        if (strcmp(CommandNames[type], name) == 0)
+        {
+            cmd->Type = (CommandType_t)type;
+
+            if (ParseArguments(jsDOC, cmd))
+                err = ESP_OK;
+            break;
+        }
+    }
+
+    cJSON_Delete(jsDOC);
+
+    return err;
+}
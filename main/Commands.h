@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <esp_err.h>
+
+#include "Deadband.h"
+
+// commands are received on <topic>/cmd and answered on <topic>/cmd/ack
+#define COMMAND_TOPIC     "cmd"
+#define COMMAND_ACK_TOPIC "cmd/ack"
+
+// commands waiting for the main loop
+#define COMMAND_QUEUE_SIZE 4
+
+// limits of the tunables
+#define COMMAND_POLL_MIN      100   // ms
+#define COMMAND_POLL_MAX      60000 // ms
+#define COMMAND_FREQUENCY_MAX 3600  // s
+#define COMMAND_BURST_MAX     600   // s
+
+typedef enum {
+    CMD_POLL,      // value: ms between modbus requests
+    CMD_FREQUENCY, // value: seconds between mqtt messages
+    CMD_FORMAT,    // arg: payload formats (sinks), e.g. "json,fields"
+    CMD_DEADBAND,  // arg: channel, deadband: the new deadband
+    CMD_BURST,     // value: seconds to poll as fast as possible and publish every sample
+    CMD_STATS,     // answer with the runtime statistics
+    CMD_SAVE,      // persist the current tunables in the configuration
+    CMD_MAX,
+    CMD_UNKNOWN = CMD_MAX // not a command, the requested name is in Name
+} CommandType_t;
+
+typedef struct
+{
+    CommandType_t Type;
+    char Name[16]; // as requested, echoed in the ack
+    int32_t Id; // echoed in the ack, -1 when the command has no id
+    int32_t Value;
+    char Arg[32];
+    DeadbandCfg_t Deadband;
+} Command_t;
+
+//
+// parse a json command, e.g. {"id":7,"cmd":"poll","value":500}
+// or {"cmd":"deadband","channel":"I_AC_Power","absolute":5,"relative":1,"max_age":300} (relative in %)
+//
+esp_err_t CommandParse(const char *payload, size_t len, Command_t *cmd);
+
+const char *CommandName(CommandType_t type);
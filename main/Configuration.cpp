@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include <esp_log.h>
 #include <esp_mac.h>
 #include <esp_wifi.h>
@@ -9,6 +11,9 @@
 #include <argtable3/argtable3.h>
 
 #include "Configuration.h"
+#include "Alerts.h"
+#include "Deadband.h"
+#include "Influx.h"
 
 #define TAG "Configuration"
 
@@ -29,6 +34,7 @@ static struct
     struct arg_str *topic;
     struct arg_int *frequency;
     struct arg_str *topic_ha;
+    struct arg_str *format;
     struct arg_end *end;
 } MQTTConfigArgs;
 
@@ -39,6 +45,39 @@ static struct
     struct arg_end *end;
 } MODBUSConfigArgs;
 
+static struct
+{
+    struct arg_int *window;
+    struct arg_end *end;
+} StatsConfigArgs;
+
+static struct
+{
+    struct arg_str *name;
+    struct arg_dbl *set;
+    struct arg_dbl *clear;
+    struct arg_int *duration;
+    struct arg_end *end;
+} AlertConfigArgs;
+
+static struct
+{
+    struct arg_str *channel;
+    struct arg_dbl *absolute;
+    struct arg_dbl *relative;
+    struct arg_int *maxage;
+    struct arg_end *end;
+} DeadbandConfigArgs;
+
+static struct
+{
+    struct arg_str *uri;
+    struct arg_str *measurement;
+    struct arg_int *batch;
+    struct arg_int *flush;
+    struct arg_end *end;
+} InfluxConfigArgs;
+
 Configuration *_configuration = nullptr;
 
 Configuration::Configuration()
@@ -201,6 +240,21 @@ void Configuration::InitConsole(void)
     const esp_console_cmd_t cmdConfMODBUS
         = { .command = "modbus", .help = "Configure MODBUS-TCP address.", .hint = nullptr, .func = &_fnMODBUSConfig, .argtable = &MODBUSConfigArgs };
 
+    const esp_console_cmd_t cmdConfStats
+        = { .command = "stats", .help = "Configure the window for the percentile statistics.", .hint = nullptr, .func = &_fnStatsConfig, .argtable = &StatsConfigArgs };
+
+    const esp_console_cmd_t cmdConfAlert
+        = { .command = "alert", .help = "Configure the thresholds of an alert.", .hint = nullptr, .func = &_fnAlertConfig, .argtable = &AlertConfigArgs };
+
+    const esp_console_cmd_t cmdConfDeadband = { .command = "deadband",
+        .help = "Configure the deadband of a field, for 'mqtt -o fields'.",
+        .hint = nullptr,
+        .func = &_fnDeadbandConfig,
+        .argtable = &DeadbandConfigArgs };
+
+    const esp_console_cmd_t cmdConfInflux
+        = { .command = "influx", .help = "Configure the InfluxDB line protocol sink.", .hint = nullptr, .func = &_fnInfluxConfig, .argtable = &InfluxConfigArgs };
+
     const esp_console_cmd_t cmdSave
         = { .command = "save", .help = "Save configuration, after configuring wifi, modbus and mqtt parameters.", .hint = nullptr, .func = &_fnSave, .argtable = nullptr };
 
@@ -216,12 +270,34 @@ void Configuration::InitConsole(void)
     MQTTConfigArgs.topic = arg_str0("t", "topic", "<mqtt topic>", "topic for the mqtt message. Default: solaredge");
     MQTTConfigArgs.frequency = arg_int0("f", "frequency", "<seconds>", "number of seconds between MQTT messages. Default: 1");
     MQTTConfigArgs.topic_ha = arg_str0("h", "HA-topic", "<mqtt HA topic>", "topic for home-assistant config messages. Default: homeassistant");
+    MQTTConfigArgs.format = arg_str0("o", "format", "<json,cbor,fields,batch>", "comma separated list of payload formats. Default: json");
     MQTTConfigArgs.end = arg_end(3);
 
     MODBUSConfigArgs.ip = arg_str1("i", "ip", "<ip address>", "IP address to SolarEdge inverter");
     MODBUSConfigArgs.port = arg_int0("p", "port", "<port number>", "port number for modbus connection. Default: 1502");
     MODBUSConfigArgs.end = arg_end(2);
 
+    StatsConfigArgs.window = arg_int1("w", "window", "<seconds>", "length of a statistics window, must divide a day. Default: 86400");
+    StatsConfigArgs.end = arg_end(1);
+
+    AlertConfigArgs.name = arg_str1("n", "name", "<alert>", "name of the alert, e.g. over_temperature");
+    AlertConfigArgs.set = arg_dbl1("s", "set", "<value>", "threshold to raise the alert");
+    AlertConfigArgs.clear = arg_dbl1("c", "clear", "<value>", "threshold to clear the alert");
+    AlertConfigArgs.duration = arg_int0("d", "duration", "<seconds>", "time the condition must hold. Default: 0");
+    AlertConfigArgs.end = arg_end(4);
+
+    DeadbandConfigArgs.channel = arg_str1("c", "channel", "<field>", "name of the field, e.g. I_AC_Power");
+    DeadbandConfigArgs.absolute = arg_dbl1("a", "absolute", "<value>", "minimal change to publish, in the unit of the field");
+    DeadbandConfigArgs.relative = arg_dbl0("r", "relative", "<percent>", "minimal change to publish, relative to the last value. Default: 0");
+    DeadbandConfigArgs.maxage = arg_int0("t", "max-age", "<seconds>", "publish at least once per max-age. Default: 300");
+    DeadbandConfigArgs.end = arg_end(4);
+
+    InfluxConfigArgs.uri = arg_str1("u", "uri", "<uri>", "udp://192.168.10.40:8089 or tcp://192.168.10.40:8094, 'off' to disable");
+    InfluxConfigArgs.measurement = arg_str0("m", "measurement", "<name>", "name of the measurement. Default: solaredge");
+    InfluxConfigArgs.batch = arg_int0("b", "batch", "<samples>", "number of samples per batch, at most 16. Default: 10");
+    InfluxConfigArgs.flush = arg_int0("f", "flush", "<seconds>", "maximum time a sample waits for its batch. Default: 10");
+    InfluxConfigArgs.end = arg_end(4);
+
     repl_config.prompt = "CFG>";
     repl_config.max_cmdline_length = 128;
 
@@ -234,6 +310,10 @@ void Configuration::InitConsole(void)
     ESP_ERROR_CHECK(esp_console_cmd_register(&cmdConfWifi));
     ESP_ERROR_CHECK(esp_console_cmd_register(&cmdConfMQTT));
     ESP_ERROR_CHECK(esp_console_cmd_register(&cmdConfMODBUS));
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmdConfStats));
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmdConfAlert));
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmdConfDeadband));
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmdConfInflux));
 
     // use the supplied uart / repl task:
     esp_console_dev_uart_config_t hw_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
@@ -279,6 +359,7 @@ int Configuration::fnReset(int argc, char **argv)
 
     Set(JS_MBIP, "");
     Set(JS_MBPORT, "");
+    Set(JS_MBDELAY, "");
 
     Set(JS_MQTT_URI, "");
     Set(JS_MQTT_USER, "");
@@ -286,6 +367,14 @@ int Configuration::fnReset(int argc, char **argv)
     Set(JS_MQTT_TOPIC, "");
     Set(JS_MQTT_FREQ, "");
     Set(JS_MQTT_TOPIC_HA, "");
+    Set(JS_MQTT_FORMAT, "");
+
+    Set(JS_STATS_WINDOW, "");
+
+    Set(JS_INFLUX_URI, "");
+    Set(JS_INFLUX_MEAS, "");
+    Set(JS_INFLUX_BATCH, "");
+    Set(JS_INFLUX_FLUSH, "");
 
     printf(LOG_COLOR(LOG_COLOR_RED) "Configuration reset to defaults\n");
 
@@ -332,13 +421,20 @@ int Configuration::fnInfo(int argc, char **argv)
     printf(LOG_COLOR(LOG_COLOR_BLUE) "WIFI-Identity (wpa2): " LOG_COLOR(LOG_COLOR_GREEN) "%s\n\n", Get(JS_IDENT));
 
     printf(LOG_COLOR(LOG_COLOR_BLUE) "MODBUS IP:            " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_MBIP));
-    printf(LOG_COLOR(LOG_COLOR_BLUE) "MODBUS port:          " LOG_COLOR(LOG_COLOR_GREEN) "%s\n\n", Get(JS_MBPORT));
+    printf(LOG_COLOR(LOG_COLOR_BLUE) "MODBUS port:          " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_MBPORT));
+    printf(LOG_COLOR(LOG_COLOR_BLUE) "MODBUS delay (ms):    " LOG_COLOR(LOG_COLOR_GREEN) "%s\n\n", Get(JS_MBDELAY));
 
     printf(LOG_COLOR(LOG_COLOR_BLUE) "MQTT URI:                 " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_MQTT_URI));
     printf(LOG_COLOR(LOG_COLOR_BLUE) "MQTT topic:               " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_MQTT_TOPIC));
     printf(LOG_COLOR(LOG_COLOR_BLUE) "MQTT Homeassistant topic: " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_MQTT_TOPIC_HA));
     printf(LOG_COLOR(LOG_COLOR_BLUE) "MQTT user:                " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_MQTT_USER));
     printf(LOG_COLOR(LOG_COLOR_BLUE) "MQTT frequency:           " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_MQTT_FREQ));
+    printf(LOG_COLOR(LOG_COLOR_BLUE) "MQTT format:              " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_MQTT_FORMAT));
+    printf(LOG_COLOR(LOG_COLOR_BLUE) "Statistics window:        " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_STATS_WINDOW));
+    printf(LOG_COLOR(LOG_COLOR_BLUE) "InfluxDB URI:             " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_INFLUX_URI));
+    printf(LOG_COLOR(LOG_COLOR_BLUE) "InfluxDB measurement:     " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_INFLUX_MEAS));
+    printf(LOG_COLOR(LOG_COLOR_BLUE) "InfluxDB batch:           " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_INFLUX_BATCH));
+    printf(LOG_COLOR(LOG_COLOR_BLUE) "InfluxDB flush:           " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_INFLUX_FLUSH));
     // printf(LOG_COLOR(LOG_COLOR_BLUE) "MQTT password: " LOG_COLOR(LOG_COLOR_GREEN) "%s\n", Get(JS_MQTT_PASS));
 
     return 0;
@@ -399,6 +495,7 @@ int Configuration::fnMQTTConfig(int argc, char **argv)
     const char *topic = MQTTConfigArgs.topic->count ? MQTTConfigArgs.topic->sval[0] : "solaredge";
     uint16_t freq = MQTTConfigArgs.frequency->count ? MQTTConfigArgs.frequency->ival[0] : 1;
     const char *topic_ha = MQTTConfigArgs.topic_ha->count ? MQTTConfigArgs.topic_ha->sval[0] : "homeassistant";
+    const char *format = MQTTConfigArgs.format->count ? MQTTConfigArgs.format->sval[0] : "json";
 
     if (freq == 0)
         freq = 1;
@@ -410,6 +507,7 @@ int Configuration::fnMQTTConfig(int argc, char **argv)
     Set(JS_MQTT_TOPIC, topic);
     Set(JS_MQTT_FREQ, buf);
     Set(JS_MQTT_TOPIC_HA, topic_ha);
+    Set(JS_MQTT_FORMAT, format);
 
     return 0;
 }
@@ -443,6 +541,170 @@ int Configuration::fnMODBUSConfig(int argc, char **argv)
     return 0;
 }
 
+int _fnStatsConfig(int argc, char **argv)
+{
+    if (_configuration)
+        return _configuration->fnStatsConfig(argc, argv);
+    else
+        return EXIT_FAILURE;
+}
+
+int Configuration::fnStatsConfig(int argc, char **argv)
+{
+    char buf[8];
+
+    int n = arg_parse(argc, argv, (void **)&StatsConfigArgs);
+    if (n != 0)
+    {
+        printf("\n" LOG_COLOR(LOG_COLOR_RED) "Error in arguments. Type 'help' for info.\n");
+        return EXIT_FAILURE;
+    }
+
+    int window = StatsConfigArgs.window->ival[0];
+    if (window <= 0 || window > 86400 || (86400 % window) != 0)
+    {
+        printf("\n" LOG_COLOR(LOG_COLOR_RED) "The window must divide a day (86400 seconds).\n");
+        return EXIT_FAILURE;
+    }
+
+    snprintf(buf, sizeof(buf), "%d", window);
+    Set(JS_STATS_WINDOW, buf);
+
+    return 0;
+}
+
+int _fnAlertConfig(int argc, char **argv)
+{
+    if (_configuration)
+        return _configuration->fnAlertConfig(argc, argv);
+    else
+        return EXIT_FAILURE;
+}
+
+int Configuration::fnAlertConfig(int argc, char **argv)
+{
+    char key[48], buf[48];
+
+    int n = arg_parse(argc, argv, (void **)&AlertConfigArgs);
+    if (n != 0)
+    {
+        printf("\n" LOG_COLOR(LOG_COLOR_RED) "Error in arguments. Type 'help' for info.\n");
+        return EXIT_FAILURE;
+    }
+
+    const char *name = AlertConfigArgs.name->sval[0];
+    uint8_t i;
+
+    for (i = 0; i != AlertNumDefaultRules; i++)
+    {
+        if (strcmp(AlertDefaultRules[i].Name, name) == 0)
+            break;
+    }
+
+    if (i == AlertNumDefaultRules)
+    {
+        printf("\n" LOG_COLOR(LOG_COLOR_RED) "Unknown alert, available:");
+        for (i = 0; i != AlertNumDefaultRules; i++)
+            printf(" %s", AlertDefaultRules[i].Name);
+        printf("\n");
+
+        return EXIT_FAILURE;
+    }
+
+    snprintf(key, sizeof(key), JS_ALERT_PREFIX "%s", name);
+    snprintf(buf, sizeof(buf), "%g,%g,%d", AlertConfigArgs.set->dval[0], AlertConfigArgs.clear->dval[0],
+        AlertConfigArgs.duration->count ? AlertConfigArgs.duration->ival[0] : 0);
+    Set(key, buf);
+
+    return 0;
+}
+
+int _fnDeadbandConfig(int argc, char **argv)
+{
+    if (_configuration)
+        return _configuration->fnDeadbandConfig(argc, argv);
+    else
+        return EXIT_FAILURE;
+}
+
+int Configuration::fnDeadbandConfig(int argc, char **argv)
+{
+    char key[48], buf[48];
+
+    int n = arg_parse(argc, argv, (void **)&DeadbandConfigArgs);
+    if (n != 0)
+    {
+        printf("\n" LOG_COLOR(LOG_COLOR_RED) "Error in arguments. Type 'help' for info.\n");
+        return EXIT_FAILURE;
+    }
+
+    const char *name = DeadbandConfigArgs.channel->sval[0];
+    SEChannel_t ch = SE_ChannelByName(name);
+
+    if (ch == CH_MAX)
+    {
+        printf("\n" LOG_COLOR(LOG_COLOR_RED) "Unknown field, available:");
+        for (int i = 0; i != CH_MAX; i++)
+            printf(" %s", SE_Channels[i].Name);
+        printf("\n");
+
+        return EXIT_FAILURE;
+    }
+
+    double relative = DeadbandConfigArgs.relative->count ? DeadbandConfigArgs.relative->dval[0] : 0;
+    int maxage = DeadbandConfigArgs.maxage->count ? DeadbandConfigArgs.maxage->ival[0] : DEADBAND_DEFAULT_MAX_AGE;
+
+    if (DeadbandConfigArgs.absolute->dval[0] < 0 || relative < 0 || maxage <= 0)
+    {
+        printf("\n" LOG_COLOR(LOG_COLOR_RED) "The deadband and max-age must be positive.\n");
+        return EXIT_FAILURE;
+    }
+
+    snprintf(key, sizeof(key), JS_DEADBAND_PREFIX "%s", SE_Channels[ch].Name);
+    snprintf(buf, sizeof(buf), "%g,%g,%d", DeadbandConfigArgs.absolute->dval[0], relative / 100.0, maxage);
+    Set(key, buf);
+
+    return 0;
+}
+
+int _fnInfluxConfig(int argc, char **argv)
+{
+    if (_configuration)
+        return _configuration->fnInfluxConfig(argc, argv);
+    else
+        return EXIT_FAILURE;
+}
+
+int Configuration::fnInfluxConfig(int argc, char **argv)
+{
+    char buf[16];
+
+    int n = arg_parse(argc, argv, (void **)&InfluxConfigArgs);
+    if (n != 0)
+    {
+        printf("\n" LOG_COLOR(LOG_COLOR_RED) "Error in arguments. Type 'help' for info.\n");
+        return EXIT_FAILURE;
+    }
+
+    const char *uri = InfluxConfigArgs.uri->sval[0];
+
+    if (strcmp(uri, "off") != 0 && strncmp(uri, "udp://", 6) != 0 && strncmp(uri, "tcp://", 6) != 0)
+    {
+        printf("\n" LOG_COLOR(LOG_COLOR_RED) "The uri must start with udp:// or tcp://\n");
+        return EXIT_FAILURE;
+    }
+
+    Set(JS_INFLUX_URI, strcmp(uri, "off") == 0 ? "" : uri);
+    Set(JS_INFLUX_MEAS, InfluxConfigArgs.measurement->count ? InfluxConfigArgs.measurement->sval[0] : "");
+
+    snprintf(buf, sizeof(buf), "%d", InfluxConfigArgs.batch->count ? InfluxConfigArgs.batch->ival[0] : INFLUX_DEFAULT_BATCH);
+    Set(JS_INFLUX_BATCH, buf);
+    snprintf(buf, sizeof(buf), "%d", InfluxConfigArgs.flush->count ? InfluxConfigArgs.flush->ival[0] : INFLUX_DEFAULT_FLUSH);
+    Set(JS_INFLUX_FLUSH, buf);
+
+    return 0;
+}
+
 int _fnSave(int argc, char **argv)
 {
     if (_configuration)
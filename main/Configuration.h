@@ -8,18 +8,27 @@
 #define CONFIGURATION_NVS_NAMESPACE "_CFG_"
 #define CONFIGURATION_NVS_JSONFILE  "JS"
 
-#define JS_WIFI          "wifi-ssid"
-#define JS_USER          "wifi-username"
-#define JS_PASS          "wifi-password"
-#define JS_IDENT         "wifi-identity"
-#define JS_MBIP          "modbus-ip"
-#define JS_MBPORT        "modbus-port"
-#define JS_MQTT_URI      "mqtt-uri"
-#define JS_MQTT_USER     "mqtt-user"
-#define JS_MQTT_PASS     "mqtt-password"
-#define JS_MQTT_TOPIC    "mqtt-topic"
-#define JS_MQTT_FREQ     "mqtt-frequency"
-#define JS_MQTT_TOPIC_HA "mqtt-topic-ha"
+#define JS_WIFI            "wifi-ssid"
+#define JS_USER            "wifi-username"
+#define JS_PASS            "wifi-password"
+#define JS_IDENT           "wifi-identity"
+#define JS_MBIP            "modbus-ip"
+#define JS_MBPORT          "modbus-port"
+#define JS_MBDELAY         "modbus-delay"
+#define JS_MQTT_URI        "mqtt-uri"
+#define JS_MQTT_USER       "mqtt-user"
+#define JS_MQTT_PASS       "mqtt-password"
+#define JS_MQTT_TOPIC      "mqtt-topic"
+#define JS_MQTT_FREQ       "mqtt-frequency"
+#define JS_MQTT_TOPIC_HA   "mqtt-topic-ha"
+#define JS_MQTT_FORMAT     "mqtt-format"
+#define JS_STATS_WINDOW    "stats-window"
+#define JS_ALERT_PREFIX    "alert-"
+#define JS_DEADBAND_PREFIX "deadband-"
+#define JS_INFLUX_URI      "influx-uri"
+#define JS_INFLUX_MEAS     "influx-measurement"
+#define JS_INFLUX_BATCH    "influx-batch"
+#define JS_INFLUX_FLUSH    "influx-flush"
 
 class Configuration
 {
@@ -43,6 +52,10 @@ public:
     int fnWifiConfig(int argc, char **argv);
     int fnMQTTConfig(int argc, char **argv);
     int fnMODBUSConfig(int argc, char **argv);
+    int fnStatsConfig(int argc, char **argv);
+    int fnAlertConfig(int argc, char **argv);
+    int fnDeadbandConfig(int argc, char **argv);
+    int fnInfluxConfig(int argc, char **argv);
 
 private:
     nvs_handle_t hNVS;
@@ -56,3 +69,7 @@ int _fnSave(int argc, char **argv);
 int _fnWifiConfig(int argc, char **argv);
 int _fnMQTTConfig(int argc, char **argv);
 int _fnMODBUSConfig(int argc, char **argv);
+int _fnStatsConfig(int argc, char **argv);
+int _fnAlertConfig(int argc, char **argv);
+int _fnDeadbandConfig(int argc, char **argv);
+int _fnInfluxConfig(int argc, char **argv);
@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+
+#include <esp_log.h>
+
+#include "Dashboard.h"
+#include "HttpServer.h"
+#include "HistoryQuery.h"
+#include "www_assets.h"
+
+#define TAG "Dashboard"
+
+extern const uint8_t index_html_gz_start[] asm("_binary_index_html_gz_start");
+extern const uint8_t index_html_gz_end[] asm("_binary_index_html_gz_end");
+extern const uint8_t app_js_gz_start[] asm("_binary_app_js_gz_start");
+extern const uint8_t app_js_gz_end[] asm("_binary_app_js_gz_end");
+
+typedef struct
+{
+    const char *uri;
+    const char *type;
+    const char *cache;
+    const char *etag;
+    const uint8_t *start;
+    const uint8_t *end;
+} Asset_t;
+
+static const Asset_t Assets[] = {
+    { "/", "text/html", "no-cache", WWW_INDEX_ETAG, index_html_gz_start, index_html_gz_end },
+    { "/app.js", "application/javascript", "public, max-age=31536000, immutable", WWW_APP_ETAG, app_js_gz_start, app_js_gz_end },
+};
+
+// a binary history point, little endian
+typedef struct __attribute__((packed))
+{
+    uint32_t start;
+    float min;
+    float mean;
+    float max;
+} HistoryRecord_t;
+
+static esp_err_t AssetHandler(httpd_req_t *req)
+{
+    const Asset_t *asset = (const Asset_t *)req->user_ctx;
+    char etag[40];
+
+    httpd_resp_set_hdr(req, "Cache-Control", asset->cache);
+    httpd_resp_set_hdr(req, "ETag", asset->etag);
+
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", etag, sizeof(etag)) == ESP_OK && strcmp(etag, asset->etag) == 0)
+    {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, nullptr, 0);
+    }
+
+    httpd_resp_set_type(req, asset->type);
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+
+    // straight from flash, nothing is copied
+    return httpd_resp_send(req, (const char *)asset->start, asset->end - asset->start);
+}
+
+static esp_err_t SendChannels(HistoryStore *history, ChunkWriter *out)
+{
+    out->Printf("{\"channels\":[");
+
+    for (uint8_t c = 0; c != history->GetNumChannels(); c++)
+    {
+        const SEChannelInfo_t *info = &SE_Channels[history->GetChannel(c)];
+        out->Printf("%s{\"name\":\"%s\",\"unit\":\"%s\"}", c ? "," : "", info->Name, info->Unit);
+    }
+
+    out->Printf("],\"tiers\":[");
+
+    for (int tier = 0; tier != HISTORY_NUM_TIERS; tier++)
+        out->Printf("%s{\"interval\":%" PRIu32 ",\"depth\":%u}", tier ? "," : "", HistoryTiers[tier].interval, HistoryTiers[tier].depth);
+
+    out->Printf("]}");
+
+    return out->End();
+}
+
+typedef struct
+{
+    ChunkWriter *out;
+    bool binary;
+    bool first;
+} HistoryOutput_t;
+
+static bool WritePoint(const HistoryPoint_t *point, void *ctx)
+{
+    HistoryOutput_t *output = (HistoryOutput_t *)ctx;
+
+    if (output->binary)
+    {
+        HistoryRecord_t rec = { (uint32_t)point->start, point->min, point->mean, point->max };
+        output->out->Write((const char *)&rec, sizeof(rec));
+    }
+    else
+        output->out->Printf("%s[%lld,%.6g,%.6g,%.6g]", output->first ? "" : ",", (long long)point->start, point->min, point->mean, point->max);
+
+    output->first = false;
+
+    // stop when the client is gone
+    return output->out->GetError() == ESP_OK;
+}
+
+static esp_err_t HistoryHandler(httpd_req_t *req)
+{
+    // the http server runs all handlers in one task
+    static char chunk_buf[1024];
+
+    HistoryStore *history = (HistoryStore *)req->user_ctx;
+    char query_buf[160], value[24];
+    time_t now = time(NULL);
+
+    ChunkWriter out(req, chunk_buf, sizeof(chunk_buf));
+
+    if (httpd_req_get_url_query_str(req, query_buf, sizeof(query_buf)) != ESP_OK)
+        query_buf[0] = '\0';
+
+    if (httpd_query_key_value(query_buf, "ch", value, sizeof(value)) != ESP_OK)
+    {
+        httpd_resp_set_type(req, "application/json");
+        return SendChannels(history, &out);
+    }
+
+    int c = history->FindChannel(SE_ChannelByName(value));
+    if (c < 0)
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "no history for this channel");
+
+    HistoryQuery_t query = { (uint8_t)c, now - 86400, now, DASHBOARD_DEFAULT_WIDTH, HISTORY_MINMAX };
+    HistoryOutput_t output = { &out, false, true };
+    HistoryResult_t result;
+
+    if (httpd_query_key_value(query_buf, "to", value, sizeof(value)) == ESP_OK)
+        query.to = strtoll(value, nullptr, 10);
+    if (httpd_query_key_value(query_buf, "from", value, sizeof(value)) == ESP_OK)
+        query.from = strtoll(value, nullptr, 10);
+    if (httpd_query_key_value(query_buf, "width", value, sizeof(value)) == ESP_OK)
+    {
+        unsigned long width = strtoul(value, nullptr, 10);
+        query.width = (width > DASHBOARD_MAX_WIDTH) ? DASHBOARD_MAX_WIDTH : width;
+    }
+    if (httpd_query_key_value(query_buf, "mode", value, sizeof(value)) == ESP_OK)
+        query.mode = HistoryModeByName(value);
+    if (httpd_query_key_value(query_buf, "format", value, sizeof(value)) == ESP_OK)
+        output.binary = (strcmp(value, "bin") == 0);
+
+    if (query.to > now)
+        query.to = now;
+    if (query.from >= query.to || query.width == 0 || query.mode == HISTORY_MODE_MAX)
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "invalid query");
+
+    if (output.binary)
+        httpd_resp_set_type(req, "application/octet-stream");
+    else
+    {
+        httpd_resp_set_type(req, "application/json");
+        out.Printf("{\"channel\":\"%s\",\"unit\":\"%s\",\"mode\":\"%s\",\"points\":[", SE_Channels[history->GetChannel(c)].Name,
+                   SE_Channels[history->GetChannel(c)].Unit, HistoryModeName(query.mode));
+    }
+
+    HistoryRun(history, &query, now, WritePoint, &output, &result);
+
+    if (!output.binary)
+        out.Printf("],\"interval\":%" PRIu32 "}", result.step);
+
+    return out.End();
+}
+
+esp_err_t DashboardRegister(httpd_handle_t server, HistoryStore *history)
+{
+    esp_err_t err = ESP_OK;
+
+    if (!server)
+        return ESP_ERR_INVALID_ARG;
+
+    for (size_t i = 0; i != sizeof(Assets) / sizeof(Assets[0]) && err == ESP_OK; i++)
+    {
+        httpd_uri_t uri = { .uri = Assets[i].uri, .method = HTTP_GET, .handler = AssetHandler, .user_ctx = (void *)&Assets[i] };
+        err = httpd_register_uri_handler(server, &uri);
+    }
+
+    if (err == ESP_OK)
+    {
+        httpd_uri_t uri = { .uri = "/api/history", .method = HTTP_GET, .handler = HistoryHandler, .user_ctx = history };
+        err = httpd_register_uri_handler(server, &uri);
+    }
+
+    if (err != ESP_OK)
+        ESP_LOGE(TAG, "httpd_register_uri_handler() failed");
+
+    return err;
+}
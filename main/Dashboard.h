@@ -0,0 +1,20 @@
+#pragma once
+
+#include <esp_err.h>
+#include <esp_http_server.h>
+
+#include "History.h"
+
+#define DASHBOARD_DEFAULT_WIDTH 600
+#define DASHBOARD_MAX_WIDTH     2000
+
+//
+// The web dashboard, for units without a display:
+//  GET /              the page, gzip'd in flash (main/www), revalidated with an ETag
+//  GET /app.js        the script, immutable: the page refers to it with the hash of its content
+//  GET /api/history   ?ch=<channel>&from=<unix>&to=<unix>&width=<points>[&format=bin]
+//                     min/mean/max of the channel, at most width points. Without ch: the channels with history.
+//
+// Assets are sent straight from flash, the history is streamed through a fixed buffer.
+//
+esp_err_t DashboardRegister(httpd_handle_t server, HistoryStore *history);
@@ -0,0 +1,72 @@
+#include <math.h>
+
+#include "Deadband.h"
+
+const DeadbandCfg_t DeadbandDefaults[CH_MAX] = {
+    { 0.05f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },  // I_AC_Current
+    { 0.05f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },  // I_AC_CurrentA
+    { 0.05f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },  // I_AC_CurrentB
+    { 0.05f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },  // I_AC_CurrentC
+    { 1.0f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_AC_VoltageAB
+    { 1.0f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_AC_VoltageBC
+    { 1.0f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_AC_VoltageCA
+    { 0.5f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_AC_VoltageAN
+    { 0.5f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_AC_VoltageBN
+    { 0.5f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_AC_VoltageCN
+    { 5.0f, 0.01f, DEADBAND_DEFAULT_MAX_AGE },  // I_AC_Power
+    { 0.02f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },  // I_AC_Frequency
+    { 10.0f, 0.01f, DEADBAND_DEFAULT_MAX_AGE }, // I_AC_VA
+    { 10.0f, 0.01f, DEADBAND_DEFAULT_MAX_AGE }, // I_AC_VAR
+    { 0.5f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_AC_PF
+    { 1.0f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_AC_Energy_WH
+    { 0.05f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },  // I_DC_Current
+    { 2.0f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_DC_Voltage
+    { 5.0f, 0.01f, DEADBAND_DEFAULT_MAX_AGE },  // I_DC_Power
+    { 0.5f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_DC_AC_Efficiency
+    { 0.5f, 0.0f, DEADBAND_DEFAULT_MAX_AGE },   // I_Temp_Sink
+};
+
+DeadbandFilter::DeadbandFilter()
+{
+    for (int ch = 0; ch != CH_MAX; ch++)
+        _cfg[ch] = DeadbandDefaults[ch];
+
+    Invalidate();
+}
+
+void DeadbandFilter::Configure(SEChannel_t ch, const DeadbandCfg_t *cfg)
+{
+    _cfg[ch] = *cfg;
+    _valid[ch] = false;
+}
+
+const DeadbandCfg_t *DeadbandFilter::GetConfig(SEChannel_t ch) const { return &_cfg[ch]; }
+
+void DeadbandFilter::Invalidate(void)
+{
+    for (int ch = 0; ch != CH_MAX; ch++)
+    {
+        _last[ch] = 0;
+        _published[ch] = 0;
+        _valid[ch] = false;
+    }
+}
+
+bool DeadbandFilter::Check(SEChannel_t ch, float value, time_t now)
+{
+    const DeadbandCfg_t &cfg = _cfg[ch];
+
+    if (_valid[ch] && (now - _published[ch]) < (time_t)cfg.MaxAge)
+    {
+        float band = fmaxf(cfg.Absolute, cfg.Relative * fabsf(_last[ch]));
+
+        if (fabsf(value - _last[ch]) <= band)
+            return false;
+    }
+
+    _last[ch] = value;
+    _published[ch] = now;
+    _valid[ch] = true;
+
+    return true;
+}
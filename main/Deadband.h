@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+#include "Channels.h"
+
+// a channel is published at least this often, even without changes
+#define DEADBAND_DEFAULT_MAX_AGE 300
+
+typedef struct
+{
+    float Absolute;  // minimal change, in the unit of the channel
+    float Relative;  // minimal change, as fraction of the last published value
+    uint32_t MaxAge; // seconds, publish anyway when the last publish is older (heartbeat)
+} DeadbandCfg_t;
+
+extern const DeadbandCfg_t DeadbandDefaults[CH_MAX];
+
+//
+// Decides per channel whether a new value is worth publishing: a change beyond the deadband
+// (the largest of the absolute and relative band) or an expired heartbeat.
+//
+class DeadbandFilter
+{
+public:
+    DeadbandFilter();
+
+    void Configure(SEChannel_t ch, const DeadbandCfg_t *cfg);
+    const DeadbandCfg_t *GetConfig(SEChannel_t ch) const;
+
+    // forget the last published values, e.g. after a reconnect to the broker
+    void Invalidate(void);
+
+    // true when the value should be published, the value is then remembered as last published value
+    bool Check(SEChannel_t ch, float value, time_t now);
+
+private:
+    DeadbandCfg_t _cfg[CH_MAX];
+    float _last[CH_MAX];
+    time_t _published[CH_MAX];
+    bool _valid[CH_MAX];
+};
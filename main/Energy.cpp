@@ -0,0 +1,78 @@
+#include <math.h>
+
+#include "Energy.h"
+
+#define US_PER_HOUR 3.6e9f
+
+EnergyIntegrator::EnergyIntegrator()
+{
+    _last_t = 0;
+    _last_ac = 0;
+    _last_dc = 0;
+
+    _counter = 0;
+    _anchor = 0;
+    _delta = 0;
+    _anchor_t = 0;
+
+    _efficiency = 0;
+    _reanchors = 0;
+    _valid = false;
+}
+
+void EnergyIntegrator::Add(int64_t t_us, float ac_w, float dc_w, float counter_wh)
+{
+    if (!_valid || counter_wh < _counter)
+    {
+        // first sample or counter reset: start from the counter
+        _anchor = counter_wh;
+        _anchor_t = t_us;
+        _delta = 0;
+        _efficiency = 0;
+        _valid = true;
+    }
+    else
+    {
+        int64_t dt = t_us - _last_t;
+
+        if (dt > 0 && dt <= ENERGY_MAX_GAP_US)
+        {
+            float h = (float)dt / US_PER_HOUR;
+            float ac_wh = 0.5f * (ac_w + _last_ac) * h;
+            float dc_wh = 0.5f * (dc_w + _last_dc) * h;
+
+            _delta += ac_wh;
+            _efficiency = (dc_wh > 0) ? 100.0f * ac_wh / dc_wh : 0;
+        }
+        else
+        {
+            // nothing integrated over the gap, resync at the next counter step
+            _anchor_t = t_us - ENERGY_REANCHOR_US;
+        }
+
+        if (counter_wh != _counter)
+        {
+            // the counter just stepped, so it is (nearly) exact right now
+            float drift = (_anchor - counter_wh) + _delta;
+
+            if (fabsf(drift) > ENERGY_MAX_DRIFT_WH || (t_us - _anchor_t) >= ENERGY_REANCHOR_US)
+            {
+                _anchor = counter_wh;
+                _anchor_t = t_us;
+                _delta = 0;
+                _reanchors++;
+            }
+        }
+    }
+
+    _last_t = t_us;
+    _last_ac = ac_w;
+    _last_dc = dc_w;
+    _counter = counter_wh;
+}
+
+float EnergyIntegrator::GetOffset(void) const { return (_anchor - _counter) + _delta; }
+
+float EnergyIntegrator::GetEfficiency(void) const { return _efficiency; }
+
+uint32_t EnergyIntegrator::GetReanchors(void) const { return _reanchors; }
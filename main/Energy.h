@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+// samples further apart than this are not integrated (connection lost, clock jump)
+#define ENERGY_MAX_GAP_US (10 * 1000 * 1000LL)
+
+// re-anchor to the inverter counter at least this often, bounds the drift of the integration
+#define ENERGY_REANCHOR_US (15 * 60 * 1000 * 1000LL)
+
+// re-anchor immediately when the integration is off by more than this amount
+#define ENERGY_MAX_DRIFT_WH 1.0f
+
+//
+// Integrates AC and DC power over time using the trapezoidal rule, to get the energy production with
+// sub-Wh resolution between the (coarse and lagging) steps of the inverter lifetime energy counter.
+//
+// The integrated energy is kept relative to an anchor, the counter value at the moment it last stepped.
+// The counter is exact at that moment, so re-anchoring bounds the drift. Everything is float and O(1)
+// per sample, the class has no dependencies and can be fed from recorded traces on a host.
+//
+class EnergyIntegrator
+{
+public:
+    EnergyIntegrator();
+
+    // add a sample: monotonic time in microseconds, power in W, inverter lifetime energy counter in Wh
+    void Add(int64_t t_us, float ac_w, float dc_w, float counter_wh);
+
+    // high resolution lifetime energy minus the counter: the Wh not yet visible in the counter
+    float GetOffset(void) const;
+
+    // DC to AC efficiency in % over the last sample interval, 0 without DC power
+    float GetEfficiency(void) const;
+
+    // number of times the integration was re-anchored to the counter
+    uint32_t GetReanchors(void) const;
+
+private:
+    int64_t _last_t;
+    float _last_ac;
+    float _last_dc;
+
+    float _counter; // last seen counter value
+    float _anchor;  // counter value at the last re-anchor
+    float _delta;   // Wh integrated since the anchor
+    int64_t _anchor_t;
+
+    float _efficiency;
+    uint32_t _reanchors;
+    bool _valid;
+};
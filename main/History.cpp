@@ -0,0 +1,175 @@
+#include <string.h>
+#include <math.h>
+
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+
+#include "History.h"
+
+#define TAG "History"
+
+const HistoryTier_t HistoryTiers[HISTORY_NUM_TIERS] = {
+    { 10, 360 },
+    { 120, 720 },
+    { 1800, 1440 },
+};
+
+HistoryStore::HistoryStore(const HistoryChannel_t *channels, uint8_t num_channels)
+{
+    _num_channels = (num_channels < HISTORY_MAX_CHANNELS) ? num_channels : HISTORY_MAX_CHANNELS;
+    memcpy(_channels, channels, _num_channels * sizeof(HistoryChannel_t));
+
+    memset(_slots, 0, sizeof(_slots));
+    memset(_open, 0, sizeof(_open));
+    _lock = nullptr;
+}
+
+esp_err_t HistoryStore::Init(void)
+{
+    for (int tier = 0; tier != HISTORY_NUM_TIERS; tier++)
+    {
+        size_t size = HistoryTiers[tier].depth * sizeof(Slot_t);
+
+        _slots[tier] = (Slot_t *)heap_caps_calloc(1, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!_slots[tier])
+            _slots[tier] = (Slot_t *)heap_caps_calloc(1, size, MALLOC_CAP_8BIT);
+
+        if (!_slots[tier])
+        {
+            ESP_LOGE(TAG, "no memory for tier %d (%u bytes)", tier, (unsigned)size);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    _lock = xSemaphoreCreateMutex();
+
+    return _lock ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+int16_t HistoryStore::Quantize(uint8_t c, float value) const
+{
+    float q = roundf(value / _channels[c].resolution);
+
+    if (q > INT16_MAX)
+        return INT16_MAX;
+    if (q < INT16_MIN)
+        return INT16_MIN;
+
+    return (int16_t)q;
+}
+
+void HistoryStore::Close(uint8_t tier)
+{
+    Open_t *open = &_open[tier];
+    Slot_t *slot = &_slots[tier][(open->start / HistoryTiers[tier].interval) % HistoryTiers[tier].depth];
+
+    slot->start = open->start;
+    for (uint8_t c = 0; c != _num_channels; c++)
+    {
+        slot->value[c][0] = Quantize(c, open->min[c]);
+        slot->value[c][1] = Quantize(c, open->sum[c] / open->count);
+        slot->value[c][2] = Quantize(c, open->max[c]);
+    }
+
+    // the sums are passed on, the next tier keeps an exact mean
+    if (tier + 1 != HISTORY_NUM_TIERS)
+    {
+        uint32_t start = open->start - (open->start % HistoryTiers[tier + 1].interval);
+
+        Accumulate(tier + 1, start, open->count, open->sum, open->min, open->max);
+    }
+
+    open->count = 0;
+}
+
+void HistoryStore::Accumulate(uint8_t tier, uint32_t start, uint32_t count, const float *sum, const float *min, const float *max)
+{
+    Open_t *open = &_open[tier];
+
+    if (open->count && open->start != start)
+        Close(tier);
+
+    for (uint8_t c = 0; c != _num_channels; c++)
+    {
+        if (open->count == 0)
+        {
+            open->sum[c] = 0;
+            open->min[c] = min[c];
+            open->max[c] = max[c];
+        }
+
+        open->sum[c] += sum[c];
+        if (min[c] < open->min[c])
+            open->min[c] = min[c];
+        if (max[c] > open->max[c])
+            open->max[c] = max[c];
+    }
+
+    open->start = start;
+    open->count += count;
+}
+
+void HistoryStore::Add(time_t now, const SolarEdge_t *se)
+{
+    float value[HISTORY_MAX_CHANNELS];
+
+    if (!_lock)
+        return;
+
+    for (uint8_t c = 0; c != _num_channels; c++)
+        value[c] = SE_ChannelValue(se, _channels[c].channel);
+
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    Accumulate(0, now - (now % HistoryTiers[0].interval), 1, value, value, value);
+    xSemaphoreGive(_lock);
+}
+
+bool HistoryStore::Read(uint8_t tier, time_t start, uint8_t c, HistoryPoint_t *point)
+{
+    bool valid = false;
+    float res = _channels[c].resolution;
+
+    if (!_lock || tier >= HISTORY_NUM_TIERS || c >= _num_channels || start <= 0)
+        return false;
+
+    xSemaphoreTake(_lock, portMAX_DELAY);
+
+    const Open_t *open = &_open[tier];
+    const Slot_t *slot = &_slots[tier][(start / HistoryTiers[tier].interval) % HistoryTiers[tier].depth];
+
+    if (open->count && open->start == (uint32_t)start)
+    {
+        point->min = open->min[c];
+        point->mean = open->sum[c] / open->count;
+        point->max = open->max[c];
+        valid = true;
+    }
+    else if (slot->start == (uint32_t)start)
+    {
+        point->min = slot->value[c][0] * res;
+        point->mean = slot->value[c][1] * res;
+        point->max = slot->value[c][2] * res;
+        valid = true;
+    }
+
+    xSemaphoreGive(_lock);
+
+    point->start = start;
+
+    return valid;
+}
+
+int HistoryStore::FindChannel(SEChannel_t channel) const
+{
+    for (uint8_t c = 0; c != _num_channels; c++)
+    {
+        if (_channels[c].channel == channel)
+            return c;
+    }
+
+    return -1;
+}
+
+uint8_t HistoryStore::GetNumChannels(void) const { return _num_channels; }
+
+SEChannel_t HistoryStore::GetChannel(uint8_t c) const { return _channels[c].channel; }
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+#include <esp_err.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "sunspec.h"
+#include "Channels.h"
+
+#define HISTORY_MAX_CHANNELS 4
+#define HISTORY_NUM_TIERS    3
+
+typedef struct
+{
+    uint32_t interval; // seconds per slot
+    uint16_t depth;    // number of slots, the tier covers interval * depth seconds
+} HistoryTier_t;
+
+// 10 s for an hour, 2 minutes for a day, 30 minutes for 30 days
+extern const HistoryTier_t HistoryTiers[HISTORY_NUM_TIERS];
+
+typedef struct
+{
+    SEChannel_t channel;
+    float resolution; // values are stored as int16_t multiples of the resolution
+} HistoryChannel_t;
+
+typedef struct
+{
+    time_t start; // start of the slot, aligned to the interval of the tier
+    float min;
+    float mean;
+    float max;
+} HistoryPoint_t;
+
+//
+// On-device history of a few channels in tiers of decreasing resolution. Every tier is a ring indexed by
+// start / interval, a closed slot of a tier is folded into the open slot of the next tier (with an exact mean).
+// Values are quantized to 16 bits, a slot of 4 channels takes 28 bytes and all tiers about 70 KB, allocated
+// from PSRAM when available.
+// Add() is called from the main loop, Read() from any task: both take a mutex for a single slot.
+//
+class HistoryStore
+{
+public:
+    HistoryStore(const HistoryChannel_t *channels, uint8_t num_channels);
+
+    esp_err_t Init(void);
+
+    void Add(time_t now, const SolarEdge_t *se);
+
+    // read channel c of the slot of a tier starting at start, also the slot still open. False when there is no data
+    bool Read(uint8_t tier, time_t start, uint8_t c, HistoryPoint_t *point);
+
+    // index of a channel in the store, -1 when the channel has no history
+    int FindChannel(SEChannel_t channel) const;
+
+    uint8_t GetNumChannels(void) const;
+    SEChannel_t GetChannel(uint8_t c) const;
+
+private:
+    typedef struct
+    {
+        uint32_t start; // 0 for a slot without data
+        int16_t value[HISTORY_MAX_CHANNELS][3]; // min, mean, max
+    } Slot_t;
+
+    typedef struct
+    {
+        uint32_t start;
+        uint32_t count;
+        float sum[HISTORY_MAX_CHANNELS];
+        float min[HISTORY_MAX_CHANNELS];
+        float max[HISTORY_MAX_CHANNELS];
+    } Open_t;
+
+    HistoryChannel_t _channels[HISTORY_MAX_CHANNELS];
+    uint8_t _num_channels;
+
+    Slot_t *_slots[HISTORY_NUM_TIERS];
+    Open_t _open[HISTORY_NUM_TIERS];
+    SemaphoreHandle_t _lock;
+
+    void Accumulate(uint8_t tier, uint32_t start, uint32_t count, const float *sum, const float *min, const float *max);
+    void Close(uint8_t tier);
+
+    int16_t Quantize(uint8_t c, float value) const;
+};
@@ -0,0 +1,266 @@
+#include <string.h>
+#include <math.h>
+
+#include "HistoryQuery.h"
+
+static const char *HistoryModeNames[HISTORY_MODE_MAX] = { "minmax", "m4", "lttb" };
+
+typedef struct
+{
+    HistoryStore *store;
+    const HistoryQuery_t *query;
+    HistorySink_t sink;
+    void *ctx;
+    HistoryResult_t *result;
+    uint32_t interval;
+    bool stopped;
+} Run_t;
+
+static bool ReadSlot(Run_t *run, time_t start, HistoryPoint_t *point)
+{
+    run->result->slots++;
+    return run->store->Read(run->result->tier, start, run->query->channel, point);
+}
+
+static void Emit(Run_t *run, const HistoryPoint_t *point)
+{
+    if (run->stopped)
+        return;
+
+    run->result->points++;
+    run->stopped = !run->sink(point, run->ctx);
+}
+
+static void BucketMinMax(Run_t *run, time_t bucket)
+{
+    HistoryPoint_t point, merged;
+    uint32_t n = 0;
+
+    for (time_t t = bucket; t < bucket + (time_t)run->result->step; t += run->interval)
+    {
+        if (!ReadSlot(run, t, &point))
+            continue;
+
+        if (n == 0)
+            merged = point;
+        else
+        {
+            merged.mean += point.mean;
+            if (point.min < merged.min)
+                merged.min = point.min;
+            if (point.max > merged.max)
+                merged.max = point.max;
+        }
+        n++;
+    }
+
+    if (n)
+    {
+        merged.start = bucket;
+        merged.mean /= n;
+        Emit(run, &merged);
+    }
+}
+
+static void BucketM4(Run_t *run, time_t bucket)
+{
+    HistoryPoint_t point, pick[4]; // first, min, max, last
+    uint32_t n = 0;
+
+    for (time_t t = bucket; t < bucket + (time_t)run->result->step; t += run->interval)
+    {
+        if (!ReadSlot(run, t, &point))
+            continue;
+
+        if (n == 0)
+            pick[0] = pick[1] = pick[2] = point;
+        if (point.min < pick[1].min)
+            pick[1] = point;
+        if (point.max > pick[2].max)
+            pick[2] = point;
+        pick[3] = point;
+        n++;
+    }
+
+    if (n == 0)
+        return;
+
+    // in time order, a slot that is picked twice is sent once
+    for (int i = 1; i != 4; i++)
+    {
+        for (int j = i; j > 0 && pick[j].start < pick[j - 1].start; j--)
+        {
+            point = pick[j];
+            pick[j] = pick[j - 1];
+            pick[j - 1] = point;
+        }
+    }
+
+    for (int i = 0; i != 4; i++)
+    {
+        if (i == 0 || pick[i].start != pick[i - 1].start)
+            Emit(run, &pick[i]);
+    }
+}
+
+// average time and mean of the slots of a bucket, false when the bucket is empty
+static bool BucketAverage(Run_t *run, time_t bucket, double *t_avg, double *v_avg)
+{
+    HistoryPoint_t point;
+    uint32_t n = 0;
+
+    *t_avg = 0;
+    *v_avg = 0;
+
+    for (time_t t = bucket; t < bucket + (time_t)run->result->step; t += run->interval)
+    {
+        if (!ReadSlot(run, t, &point))
+            continue;
+
+        *t_avg += (double)(t - run->query->from);
+        *v_avg += point.mean;
+        n++;
+    }
+
+    if (n == 0)
+        return false;
+
+    *t_avg /= n;
+    *v_avg /= n;
+
+    return true;
+}
+
+//
+// select the slot of the bucket forming the largest triangle with the previous selection (a)
+// and the average of the next bucket (c). The first slot is always selected, the last slot of
+// a bucket followed by an empty bucket as well.
+//
+static void BucketLTTB(Run_t *run, time_t bucket, HistoryPoint_t *a, bool *have_a)
+{
+    HistoryPoint_t point, best;
+    double c_t = 0, c_v = 0, best_area = -1;
+    time_t next = bucket + run->result->step;
+    bool have_c = (next < run->query->to) && BucketAverage(run, next, &c_t, &c_v);
+    bool found = false;
+
+    for (time_t t = bucket; t < bucket + (time_t)run->result->step; t += run->interval)
+    {
+        if (!ReadSlot(run, t, &point))
+            continue;
+
+        if (!*have_a)
+        {
+            // the first point of the range
+            Emit(run, &point);
+            *a = point;
+            *have_a = true;
+            continue;
+        }
+
+        if (!have_c)
+        {
+            best = point;
+            found = true;
+            continue;
+        }
+
+        double a_t = (double)(a->start - run->query->from);
+        double p_t = (double)(point.start - run->query->from);
+        double area = fabs((a_t - c_t) * (point.mean - a->mean) - (a_t - p_t) * (c_v - a->mean));
+
+        if (area > best_area)
+        {
+            best_area = area;
+            best = point;
+            found = true;
+        }
+    }
+
+    if (found)
+    {
+        Emit(run, &best);
+        *a = best;
+    }
+}
+
+uint8_t HistorySelectTier(time_t now, time_t from, time_t to, uint16_t width)
+{
+    time_t resolution = (to - from) / (width ? width : 1);
+    int finest = -1;
+
+    for (int tier = HISTORY_NUM_TIERS - 1; tier >= 0; tier--)
+    {
+        if (now - from > (time_t)HistoryTiers[tier].interval * HistoryTiers[tier].depth)
+            break;
+
+        if ((time_t)HistoryTiers[tier].interval <= resolution)
+            return tier;
+
+        finest = tier;
+    }
+
+    return (finest >= 0) ? finest : HISTORY_NUM_TIERS - 1;
+}
+
+esp_err_t HistoryRun(HistoryStore *store, const HistoryQuery_t *query, time_t now, HistorySink_t sink, void *ctx, HistoryResult_t *result)
+{
+    if (query->from >= query->to || query->width == 0 || query->mode >= HISTORY_MODE_MAX || query->channel >= store->GetNumChannels())
+        return ESP_ERR_INVALID_ARG;
+
+    // nothing is older than the coarsest tier: an earlier from would only add slots to read, without data
+    const HistoryTier_t *coarsest = &HistoryTiers[HISTORY_NUM_TIERS - 1];
+    HistoryQuery_t range = *query;
+
+    if (range.from < now - (time_t)coarsest->interval * coarsest->depth)
+        range.from = now - (time_t)coarsest->interval * coarsest->depth;
+
+    Run_t run = { store, &range, sink, ctx, result, 0, false };
+
+    memset(result, 0, sizeof(*result));
+    if (range.from >= range.to)
+        return ESP_OK;
+
+    result->tier = HistorySelectTier(now, range.from, range.to, range.width);
+
+    // a bucket is a whole number of slots
+    run.interval = HistoryTiers[result->tier].interval;
+    time_t slots = ((range.to - range.from) + (time_t)range.width * run.interval - 1) / ((time_t)range.width * run.interval);
+    result->step = slots * run.interval;
+
+    HistoryPoint_t a;
+    bool have_a = false;
+
+    for (time_t bucket = range.from - (range.from % result->step); bucket < range.to && !run.stopped; bucket += result->step)
+    {
+        switch (range.mode)
+        {
+            case HISTORY_M4:
+                BucketM4(&run, bucket);
+                break;
+
+            case HISTORY_LTTB:
+                BucketLTTB(&run, bucket, &a, &have_a);
+                break;
+
+            default:
+                BucketMinMax(&run, bucket);
+                break;
+        }
+    }
+
+    return ESP_OK;
+}
+
+HistoryMode_t HistoryModeByName(const char *name)
+{
+    for (int mode = 0; mode != HISTORY_MODE_MAX; mode++)
+    {
+        if (strcmp(name, HistoryModeNames[mode]) == 0)
+            return (HistoryMode_t)mode;
+    }
+
+    return HISTORY_MODE_MAX;
+}
+
+const char *HistoryModeName(HistoryMode_t mode) { return (mode < HISTORY_MODE_MAX) ? HistoryModeNames[mode] : "unknown"; }
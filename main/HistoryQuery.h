@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+#include <esp_err.h>
+
+#include "History.h"
+
+typedef enum {
+    HISTORY_MINMAX = 0, // a point per bucket: min of the minima, mean, max of the maxima
+    HISTORY_M4,         // the slots with the first, smallest, largest and last value of every bucket, in time order
+    HISTORY_LTTB,       // a slot per bucket, largest triangle three buckets on the means
+    HISTORY_MODE_MAX
+} HistoryMode_t;
+
+typedef struct
+{
+    uint8_t channel; // index in the store, see HistoryStore::FindChannel()
+    time_t from;
+    time_t to;
+    uint16_t width; // number of buckets, the resolution the consumer can show
+    HistoryMode_t mode;
+} HistoryQuery_t;
+
+typedef struct
+{
+    uint8_t tier;
+    uint32_t step;   // seconds per bucket, a multiple of the interval of the tier
+    uint32_t slots;  // slots read
+    uint32_t points; // points passed to the sink
+} HistoryResult_t;
+
+// receives the points in time order, return false to stop the query
+typedef bool (*HistorySink_t)(const HistoryPoint_t *point, void *ctx);
+
+//
+// the coarsest tier with at least one slot per bucket that still holds from,
+// or the finest tier holding from when none has enough resolution
+//
+uint8_t HistorySelectTier(time_t now, time_t from, time_t to, uint16_t width);
+
+//
+// run a range query: the slots of the selected tier are decimated per bucket and streamed to the sink,
+// nothing is buffered beyond a bucket (LTTB: two buckets). from is clamped to the start of the coarsest
+// tier, so a query reads at most about the depth of that tier in slots.
+//
+esp_err_t HistoryRun(HistoryStore *store, const HistoryQuery_t *query, time_t now, HistorySink_t sink, void *ctx, HistoryResult_t *result);
+
+// "minmax", "m4" or "lttb", HISTORY_MODE_MAX when unknown
+HistoryMode_t HistoryModeByName(const char *name);
+const char *HistoryModeName(HistoryMode_t mode);
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include <esp_log.h>
+
+#include "HttpServer.h"
+
+#define TAG "HttpServer"
+
+httpd_handle_t HttpServerStart(void)
+{
+    httpd_handle_t server = nullptr;
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+
+    config.server_port = HTTP_SERVER_PORT;
+    config.max_uri_handlers = HTTP_SERVER_MAX_HANDLERS;
+    config.lru_purge_enable = true;
+
+    if (httpd_start(&server, &config) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "httpd_start() failed");
+        return nullptr;
+    }
+
+    ESP_LOGI(TAG, "Listening on port %d", config.server_port);
+
+    return server;
+}
+
+ChunkWriter::ChunkWriter(httpd_req_t *req, char *buf, size_t size) : _req(req), _buf(buf), _size(size), _len(0), _err(ESP_OK) { }
+
+void ChunkWriter::Printf(const char *fmt, ...)
+{
+    va_list args;
+
+    for (int attempt = 0; attempt != 2 && _err == ESP_OK; attempt++)
+    {
+        va_start(args, fmt);
+        int n = vsnprintf(_buf + _len, _size - _len, fmt, args);
+        va_end(args);
+
+        if (n >= 0 && (size_t)n < _size - _len)
+        {
+            _len += n;
+            return;
+        }
+
+        // does not fit behind the buffered text, send that first
+        if (_len == 0)
+            break;
+
+        Flush();
+    }
+
+    if (_err == ESP_OK)
+        _err = ESP_ERR_INVALID_SIZE;
+}
+
+void ChunkWriter::Write(const char *data, size_t len)
+{
+    while (len && _err == ESP_OK)
+    {
+        if (_len == _size)
+            Flush();
+
+        size_t n = (len < _size - _len) ? len : _size - _len;
+
+        memcpy(_buf + _len, data, n);
+        _len += n;
+        data += n;
+        len -= n;
+    }
+}
+
+esp_err_t ChunkWriter::Flush(void)
+{
+    if (_len && _err == ESP_OK)
+        _err = httpd_resp_send_chunk(_req, _buf, _len);
+
+    _len = 0;
+
+    return _err;
+}
+
+esp_err_t ChunkWriter::End(void)
+{
+    Flush();
+
+    if (_err == ESP_OK)
+        _err = httpd_resp_send_chunk(_req, nullptr, 0);
+
+    return _err;
+}
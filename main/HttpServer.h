@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stddef.h>
+
+#include <esp_err.h>
+#include <esp_http_server.h>
+
+#define HTTP_SERVER_PORT         80
+#define HTTP_SERVER_MAX_HANDLERS 12
+
+// start the http server, the endpoints register themselves on the returned handle
+httpd_handle_t HttpServerStart(void);
+
+//
+// Buffers text in a caller supplied buffer and sends it as http chunks, so a response of any size
+// is streamed without heap. A single Printf() must fit in the buffer.
+//
+class ChunkWriter
+{
+public:
+    ChunkWriter(httpd_req_t *req, char *buf, size_t size);
+
+    void Printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+    void Write(const char *data, size_t len);
+
+    esp_err_t Flush(void);
+    esp_err_t End(void); // flush and terminate the chunked response
+
+    esp_err_t GetError(void) const { return _err; }
+
+private:
+    httpd_req_t *_req;
+    char *_buf;
+    size_t _size;
+    size_t _len;
+    esp_err_t _err;
+};
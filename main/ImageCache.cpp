@@ -0,0 +1,110 @@
+#include <string.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+
+#include "ImageCache.h"
+
+#define TAG "ImageCache"
+
+extern const uint8_t images_rle_start[] asm("_binary_images_rle_start");
+extern const uint8_t images_rle_end[] asm("_binary_images_rle_end");
+
+typedef struct
+{
+    uint16_t w;
+    uint16_t h;
+    uint32_t offset;
+    uint32_t size;
+} ImageAsset_t;
+
+static const ImageAsset_t Assets[IMG_COUNT] = IMG_TABLE;
+
+static lv_img_dsc_t Images[IMG_COUNT];
+
+// false when the data does not fill exactly pixels
+static bool Decode(const uint8_t *src, size_t size, uint16_t *dst, size_t pixels)
+{
+    const uint8_t *end = src + size;
+    size_t n = 0;
+
+    while (src < end)
+    {
+        uint8_t ctrl = *src++;
+        size_t count = (ctrl & 0x7f) + 1;
+
+        if (n + count > pixels)
+            return false;
+
+        if (ctrl & 0x80)
+        {
+            if (end - src < 2)
+                return false;
+
+            uint16_t px = src[0] | (src[1] << 8);
+            src += 2;
+
+            for (size_t i = 0; i != count; i++)
+                dst[n++] = px;
+        }
+        else
+        {
+            if ((size_t)(end - src) < count * 2)
+                return false;
+
+            // little endian, like the ESP32
+            memcpy(&dst[n], src, count * 2);
+            src += count * 2;
+            n += count;
+        }
+    }
+
+    return n == pixels;
+}
+
+esp_err_t ImageCacheInit(void)
+{
+    int64_t start = esp_timer_get_time();
+    size_t total = 0;
+
+    for (uint8_t id = 0; id != IMG_COUNT; id++)
+    {
+        const ImageAsset_t *asset = &Assets[id];
+        size_t size = (size_t)asset->w * asset->h * sizeof(uint16_t);
+
+        if (asset->offset + asset->size > (size_t)(images_rle_end - images_rle_start))
+            return ESP_ERR_INVALID_SIZE;
+
+        uint16_t *pixels = (uint16_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        if (!pixels)
+            pixels = (uint16_t *)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        if (!pixels)
+            return ESP_ERR_NO_MEM;
+
+        if (!Decode(images_rle_start + asset->offset, asset->size, pixels, (size_t)asset->w * asset->h))
+        {
+            ESP_LOGE(TAG, "image %u is corrupt", id);
+            heap_caps_free(pixels);
+            return ESP_ERR_INVALID_RESPONSE;
+        }
+
+        lv_img_dsc_t *img = &Images[id];
+        img->header.cf = LV_IMG_CF_TRUE_COLOR;
+        img->header.always_zero = 0;
+        img->header.reserved = 0;
+        img->header.w = asset->w;
+        img->header.h = asset->h;
+        img->data_size = size;
+        img->data = (const uint8_t *)pixels;
+
+        total += size;
+    }
+
+    ESP_LOGI(TAG, "%u images, %u bytes from %u in flash, decoded in %lld us", IMG_COUNT, (unsigned)total, (unsigned)(images_rle_end - images_rle_start),
+             (long long)(esp_timer_get_time() - start));
+
+    return ESP_OK;
+}
+
+const lv_img_dsc_t *ImageCacheGet(uint8_t id) { return (id < IMG_COUNT && Images[id].data) ? &Images[id] : nullptr; }
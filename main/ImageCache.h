@@ -0,0 +1,16 @@
+#pragma once
+
+#include <esp_err.h>
+
+#include <lvgl.h>
+
+#include "image_assets.h"
+
+//
+// The images of the display, run length encoded in flash (tools/embed_images.py). They are decoded once,
+// into PSRAM, and LVGL blits from there.
+//
+esp_err_t ImageCacheInit(void);
+
+// the decoded image, IMG_SE_LOGO ...; nullptr when ImageCacheInit() failed
+const lv_img_dsc_t *ImageCacheGet(uint8_t id);
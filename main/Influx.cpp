@@ -0,0 +1,282 @@
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netdb.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include "Influx.h"
+#include "Channels.h"
+#include "TextWriter.h"
+
+#define TAG "Influx"
+
+InfluxSink::InfluxSink()
+{
+    _task = nullptr;
+    _tcp = false;
+    _host[0] = '\0';
+    _port = 0;
+    _socket = -1;
+
+    _measurement[0] = '\0';
+    _serial[0] = '\0';
+    _prefix[0] = '\0';
+    _batch = INFLUX_DEFAULT_BATCH;
+    _flush = INFLUX_DEFAULT_FLUSH;
+
+    _len = 0;
+    _lines = 0;
+    _oldest = 0;
+
+    _dropped = 0;
+    _sent = 0;
+    _errors = 0;
+}
+
+esp_err_t InfluxSink::Configure(const char *uri, const char *measurement, uint16_t batch, uint32_t flush)
+{
+    unsigned port = 0;
+
+    if (!uri)
+        return ESP_ERR_INVALID_ARG;
+
+    if (strncmp(uri, "udp://", 6) == 0)
+        _tcp = false;
+    else if (strncmp(uri, "tcp://", 6) == 0)
+        _tcp = true;
+    else
+        return ESP_ERR_INVALID_ARG;
+
+    if (sscanf(uri + 6, "%63[^:]:%u", _host, &port) != 2 || port == 0 || port > 65535)
+        return ESP_ERR_INVALID_ARG;
+
+    _port = port;
+
+    snprintf(_measurement, sizeof(_measurement), "%s", (measurement && measurement[0]) ? measurement : INFLUX_DEFAULT_MEASUREMENT);
+    _prefix[0] = '\0';
+
+    _batch = (batch == 0) ? 1 : (batch > INFLUX_MAX_BATCH ? INFLUX_MAX_BATCH : batch);
+    _flush = (flush == 0) ? 1 : flush;
+
+    return ESP_OK;
+}
+
+esp_err_t InfluxSink::Start(void)
+{
+    if (_port == 0)
+        return ESP_ERR_INVALID_STATE;
+
+    if (xTaskCreate(Task, "Influx", configMINIMAL_STACK_SIZE * 4, this, 3, &_task) != pdPASS)
+        return ESP_FAIL;
+
+    ESP_LOGI(TAG, "Sending to %s://%s:%u", _tcp ? "tcp" : "udp", _host, _port);
+
+    return ESP_OK;
+}
+
+bool InfluxSink::Push(const SolarEdge_t *se)
+{
+    if (!_task)
+        return false;
+
+    if (!_queue.Push(*se))
+    {
+        _dropped++;
+        return false;
+    }
+
+    xTaskNotifyGive(_task);
+
+    return true;
+}
+
+size_t InfluxSink::FormatLine(const SolarEdge_t *se, char *buf, size_t size)
+{
+    // the measurement and tags only change with the inverter
+    if (_prefix[0] == '\0' || strncmp(_serial, (const char *)se->C_SerialNumber, sizeof(se->C_SerialNumber)) != 0)
+    {
+        size_t n;
+
+        memcpy(_serial, se->C_SerialNumber, sizeof(se->C_SerialNumber));
+        _serial[sizeof(se->C_SerialNumber)] = '\0';
+
+        TextWriter prefix(_prefix, sizeof(_prefix));
+
+        prefix.Printf("%s", _measurement);
+
+        // tag values can not hold spaces, commas or equal signs
+        for (n = strlen(_serial); n && _serial[n - 1] == ' '; n--)
+            ;
+        if (n)
+        {
+            prefix.Printf(",serial=");
+            for (size_t i = 0; i != n; i++)
+                prefix.Printf((_serial[i] == ' ' || _serial[i] == ',' || _serial[i] == '=') ? "\\%c" : "%c", _serial[i]);
+        }
+
+        prefix.Printf(" ");
+    }
+
+    TextWriter out(buf, size);
+
+    out.Printf("%s", _prefix);
+
+    for (int ch = 0; ch != CH_MAX; ch++)
+    {
+        out.Printf(ch ? ",%s=" : "%s=", SE_Channels[ch].Name);
+        out.Number(SE_ChannelValue(se, (SEChannel_t)ch));
+    }
+
+    out.Printf(",I_Status=%ui,I_Status_Vendor=%ui %lld000\n", (unsigned)se->I_Status, (unsigned)se->I_Status_Vendor, (long long)se->Timestamp);
+
+    return out.Overflow() ? 0 : out.Length();
+}
+
+esp_err_t InfluxSink::Connect(void)
+{
+    struct addrinfo hints, *res = nullptr;
+    char port[8];
+
+    if (_socket >= 0)
+        return ESP_OK;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = _tcp ? SOCK_STREAM : SOCK_DGRAM;
+
+    snprintf(port, sizeof(port), "%u", _port);
+    if (getaddrinfo(_host, port, &hints, &res) != 0 || !res)
+    {
+        ESP_LOGI(TAG, "Unknown host %s", _host);
+        return ESP_FAIL;
+    }
+
+    _socket = socket(res->ai_family, res->ai_socktype, 0);
+    if (_socket >= 0)
+    {
+        struct timeval timeout = { .tv_sec = 5, .tv_usec = 0 };
+
+        setsockopt(_socket, SOL_SOCKET, SO_SNDTIMEO, (const char *)&timeout, sizeof(timeout));
+
+        // udp: connect() only sets the default destination
+        if (connect(_socket, res->ai_addr, res->ai_addrlen) != 0)
+            Disconnect();
+    }
+
+    freeaddrinfo(res);
+
+    return (_socket >= 0) ? ESP_OK : ESP_FAIL;
+}
+
+void InfluxSink::Disconnect(void)
+{
+    if (_socket >= 0)
+        close(_socket);
+
+    _socket = -1;
+}
+
+esp_err_t InfluxSink::Flush(void)
+{
+    esp_err_t err = ESP_OK;
+
+    if (_len == 0)
+        return ESP_OK;
+
+    if (Connect() != ESP_OK)
+        err = ESP_FAIL;
+    else if (_tcp)
+    {
+        for (size_t done = 0; done != _len && err == ESP_OK;)
+        {
+            ssize_t n = send(_socket, _buffer + done, _len - done, 0);
+
+            if (n <= 0)
+                err = ESP_FAIL;
+            else
+                done += n;
+        }
+    }
+    else
+    {
+        // split at line ends, every datagram holds complete lines
+        size_t start = 0;
+
+        while (start != _len && err == ESP_OK)
+        {
+            size_t end = start;
+
+            // as many lines as fit, at least one
+            do
+            {
+                const char *nl = (const char *)memchr(_buffer + end, '\n', _len - end);
+                size_t next = nl ? (size_t)(nl - _buffer) + 1 : _len;
+
+                if (end != start && next - start > INFLUX_UDP_PAYLOAD)
+                    break;
+
+                end = next;
+            } while (end != _len);
+
+            if (send(_socket, _buffer + start, end - start, 0) < 0)
+                err = ESP_FAIL;
+
+            start = end;
+        }
+    }
+
+    if (err == ESP_OK)
+        _sent += _lines;
+    else
+    {
+        // the batch is lost, a sink must not hold the samples of an unreachable server
+        _errors++;
+        _dropped += _lines;
+        Disconnect();
+    }
+
+    _len = 0;
+    _lines = 0;
+
+    return err;
+}
+
+void InfluxSink::Run(void)
+{
+    SolarEdge_t se;
+    char line[INFLUX_LINE_SIZE];
+
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+
+        while (_queue.Pop(&se))
+        {
+            size_t n = FormatLine(&se, line, sizeof(line));
+
+            if (n == 0)
+                continue;
+
+            if (_len + n > sizeof(_buffer))
+                Flush();
+
+            if (_lines == 0)
+                _oldest = esp_timer_get_time();
+
+            memcpy(_buffer + _len, line, n);
+            _len += n;
+            _lines++;
+
+            if (_lines >= _batch)
+                Flush();
+        }
+
+        if (_lines && (esp_timer_get_time() - _oldest) >= (int64_t)_flush * 1000000LL)
+            Flush();
+    }
+}
+
+void InfluxSink::Task(void *param) { ((InfluxSink *)param)->Run(); }
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <esp_err.h>
+
+#include "sunspec.h"
+#include "SpscQueue.h"
+
+#define INFLUX_DEFAULT_MEASUREMENT "solaredge"
+#define INFLUX_DEFAULT_BATCH       10   // samples
+#define INFLUX_DEFAULT_FLUSH       10   // seconds
+#define INFLUX_MAX_BATCH           16   // samples, bounded by INFLUX_BUFFER_SIZE
+#define INFLUX_QUEUE_SIZE          16   // samples waiting for the sender task, must be a power of two
+#define INFLUX_LINE_SIZE           512  // one sample
+#define INFLUX_BUFFER_SIZE         8192 // one batch
+#define INFLUX_UDP_PAYLOAD         1400 // lines are split over datagrams that fit in one ethernet frame
+
+//
+// InfluxDB line protocol sink, over udp (udp://host:port) or tcp (tcp://host:port):
+//
+//  solaredge,serial=7E0A1B2C I_AC_Current=2.6,...,I_Temp_Sink=47.35,I_Status=4i 1697666400123456000
+//
+// The main loop pushes samples without blocking, a sender task formats and sends them in batches of
+// 'batch' samples, or earlier when the oldest sample waits 'flush' seconds.
+// The timestamp is the capture time of the sample in nanoseconds.
+//
+class InfluxSink
+{
+public:
+    InfluxSink();
+
+    esp_err_t Configure(const char *uri, const char *measurement, uint16_t batch, uint32_t flush);
+    esp_err_t Start(void);
+
+    // called for every sample, returns false when the sender task is behind and the sample is dropped
+    bool Push(const SolarEdge_t *se);
+
+    uint32_t GetDropped(void) const { return _dropped; }
+    uint32_t GetSent(void) const { return _sent; }
+    uint32_t GetErrors(void) const { return _errors; }
+
+    // one line for a sample, returns the length or 0 when it does not fit
+    size_t FormatLine(const SolarEdge_t *se, char *buf, size_t size);
+
+private:
+    SpscQueue<SolarEdge_t, INFLUX_QUEUE_SIZE> _queue;
+    TaskHandle_t _task;
+
+    bool _tcp;
+    char _host[64];
+    uint16_t _port;
+    int _socket;
+
+    char _measurement[32];
+    char _serial[33];
+    char _prefix[96]; // measurement and tags, rebuilt when the serial number changes
+    uint16_t _batch;
+    uint32_t _flush;
+
+    char _buffer[INFLUX_BUFFER_SIZE];
+    size_t _len;
+    uint16_t _lines;
+    int64_t _oldest; // esp_timer time of the oldest line in the buffer
+
+    volatile uint32_t _dropped;
+    volatile uint32_t _sent;
+    volatile uint32_t _errors;
+
+    static void Task(void *param);
+    void Run(void);
+
+    esp_err_t Connect(void);
+    void Disconnect(void);
+    esp_err_t Flush(void);
+};
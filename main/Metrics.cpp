@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <inttypes.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <esp_log.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+
+#include "Metrics.h"
+#include "HttpServer.h"
+#include "Channels.h"
+#include "WsStream.h"
+
+#ifdef CONFIG_SOLAREDGE_USE_LCD
+#include "lcd.h"
+#endif
+
+#define TAG "Metrics"
+
+#define METRICS_PREFIX "solaredge_"
+
+// metric names, built once: solaredge_i_ac_power
+static char MetricNames[CH_MAX][40];
+
+static void WriteChannels(ChunkWriter *out, const SolarEdge_t *se)
+{
+    static char serial[sizeof(se->C_SerialNumber) + 1];
+    static char labels[sizeof(serial) + 16];
+
+    // the label only changes with the inverter
+    if (labels[0] == '\0' || strncmp(serial, (const char *)se->C_SerialNumber, sizeof(se->C_SerialNumber)) != 0)
+    {
+        size_t n;
+
+        memcpy(serial, se->C_SerialNumber, sizeof(se->C_SerialNumber));
+        serial[sizeof(se->C_SerialNumber)] = '\0';
+
+        for (n = strlen(serial); n && serial[n - 1] == ' '; n--)
+            serial[n - 1] = '\0';
+        for (n = 0; serial[n]; n++)
+        {
+            if (serial[n] == '"' || serial[n] == '\\' || !isprint((unsigned char)serial[n]))
+                serial[n] = '_';
+        }
+
+        snprintf(labels, sizeof(labels), "{serial=\"%s\"}", serial);
+    }
+
+    for (int ch = 0; ch != CH_MAX; ch++)
+    {
+        out->Printf("# HELP %s %s [%s]\n# TYPE %s %s\n%s%s %.7g\n", MetricNames[ch], SE_Channels[ch].Name, SE_Channels[ch].Unit, MetricNames[ch],
+            ch == CH_I_AC_Energy_WH ? "counter" : "gauge", MetricNames[ch], labels, SE_ChannelValue(se, (SEChannel_t)ch));
+    }
+
+    out->Printf("# TYPE " METRICS_PREFIX "i_status gauge\n" METRICS_PREFIX "i_status%s %u\n", labels, (unsigned)se->I_Status);
+    out->Printf("# TYPE " METRICS_PREFIX "i_status_vendor gauge\n" METRICS_PREFIX "i_status_vendor%s %u\n", labels, (unsigned)se->I_Status_Vendor);
+    out->Printf("# TYPE " METRICS_PREFIX "sample_timestamp_seconds gauge\n" METRICS_PREFIX "sample_timestamp_seconds %.3f\n", se->Timestamp / 1e6);
+}
+
+static void WriteHealth(ChunkWriter *out, const TaskModbus_t *data)
+{
+    out->Printf("# TYPE " METRICS_PREFIX "uptime_seconds gauge\n" METRICS_PREFIX "uptime_seconds %lld\n", (long long)(esp_timer_get_time() / 1000000LL));
+    out->Printf("# TYPE " METRICS_PREFIX "heap_free_bytes gauge\n" METRICS_PREFIX "heap_free_bytes %" PRIu32 "\n", esp_get_free_heap_size());
+    out->Printf("# TYPE " METRICS_PREFIX "heap_min_free_bytes gauge\n" METRICS_PREFIX "heap_min_free_bytes %" PRIu32 "\n", esp_get_minimum_free_heap_size());
+
+    out->Printf("# TYPE " METRICS_PREFIX "modbus_requests_total counter\n" METRICS_PREFIX "modbus_requests_total %" PRIu32 "\n", data->mbstats.requests);
+    out->Printf("# TYPE " METRICS_PREFIX "modbus_errors_total counter\n" METRICS_PREFIX "modbus_errors_total %" PRIu32 "\n", data->mbstats.errors);
+    out->Printf("# TYPE " METRICS_PREFIX "modbus_reconnects_total counter\n" METRICS_PREFIX "modbus_reconnects_total %" PRIu32 "\n", data->mbstats.reconnects);
+    out->Printf("# TYPE " METRICS_PREFIX "modbus_rtt_seconds gauge\n" METRICS_PREFIX "modbus_rtt_seconds %.6f\n", data->mbstats.rtt_us / 1e6);
+    out->Printf("# TYPE " METRICS_PREFIX "modbus_rtt_max_seconds gauge\n" METRICS_PREFIX "modbus_rtt_max_seconds %.6f\n", data->mbstats.rtt_max_us / 1e6);
+    out->Printf("# TYPE " METRICS_PREFIX "ws_dropped_frames_total counter\n" METRICS_PREFIX "ws_dropped_frames_total %" PRIu32 "\n", WsStreamDropped());
+
+#ifdef CONFIG_SOLAREDGE_USE_LCD
+    LcdStats_t lcd;
+    LCDGetStats(&lcd);
+
+    out->Printf("# TYPE " METRICS_PREFIX "lvgl_frames_total counter\n" METRICS_PREFIX "lvgl_frames_total %" PRIu32 "\n", lcd.frames);
+    out->Printf("# TYPE " METRICS_PREFIX "lvgl_render_seconds_total counter\n" METRICS_PREFIX "lvgl_render_seconds_total %.3f\n", lcd.render_ms / 1e3);
+    out->Printf("# TYPE " METRICS_PREFIX "lvgl_flush_seconds_total counter\n" METRICS_PREFIX "lvgl_flush_seconds_total %.3f\n", lcd.flush_us / 1e6);
+    out->Printf("# TYPE " METRICS_PREFIX "lvgl_rendered_pixels_total counter\n" METRICS_PREFIX "lvgl_rendered_pixels_total %llu\n", (unsigned long long)lcd.pixels);
+    out->Printf("# TYPE " METRICS_PREFIX "lvgl_busy_seconds_total counter\n" METRICS_PREFIX "lvgl_busy_seconds_total %.3f\n", lcd.busy_us / 1e6);
+    out->Printf("# TYPE " METRICS_PREFIX "lvgl_idle_seconds_total counter\n" METRICS_PREFIX "lvgl_idle_seconds_total %.3f\n", lcd.idle_us / 1e6);
+    out->Printf("# TYPE " METRICS_PREFIX "lvgl_first_frame_seconds gauge\n" METRICS_PREFIX "lvgl_first_frame_seconds %.3f\n", lcd.first_frame_ms / 1e3);
+    out->Printf("# TYPE " METRICS_PREFIX "touch_reads_total counter\n" METRICS_PREFIX "touch_reads_total %" PRIu32 "\n", lcd.touch_reads);
+#endif
+
+#if configUSE_TRACE_FACILITY
+    static TaskStatus_t tasks[METRICS_MAX_TASKS];
+    UBaseType_t n = uxTaskGetSystemState(tasks, METRICS_MAX_TASKS, nullptr);
+
+    out->Printf("# TYPE " METRICS_PREFIX "task_stack_free_bytes gauge\n");
+    for (UBaseType_t i = 0; i != n; i++)
+        out->Printf(METRICS_PREFIX "task_stack_free_bytes{task=\"%s\"} %u\n", tasks[i].pcTaskName, (unsigned)tasks[i].usStackHighWaterMark);
+
+#if configGENERATE_RUN_TIME_STATS
+    // the run time counter runs on esp_timer, in microseconds
+    out->Printf("# TYPE " METRICS_PREFIX "task_cpu_seconds_total counter\n");
+    for (UBaseType_t i = 0; i != n; i++)
+        out->Printf(METRICS_PREFIX "task_cpu_seconds_total{task=\"%s\"} %.6f\n", tasks[i].pcTaskName, (double)tasks[i].ulRunTimeCounter / 1e6);
+#endif
+#endif
+}
+
+static esp_err_t MetricsHandler(httpd_req_t *req)
+{
+    // the http server runs all handlers in one task
+    static char chunk_buf[1024];
+    static SolarEdge_t se;
+
+    TaskModbus_t *data = (TaskModbus_t *)req->user_ctx;
+    bool valid = false;
+
+    // a write in progress takes microseconds, give the modbus task a tick to finish it
+    for (int retry = 0; retry != 5 && !(valid = data->snapshot.TryRead(&se)); retry++)
+        vTaskDelay(1);
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+
+    ChunkWriter out(req, chunk_buf, sizeof(chunk_buf));
+
+    if (valid)
+        WriteChannels(&out, &se);
+
+    WriteHealth(&out, data);
+
+    return out.End();
+}
+
+esp_err_t MetricsRegister(httpd_handle_t server, TaskModbus_t *data)
+{
+    if (!server)
+        return ESP_ERR_INVALID_ARG;
+
+    for (int ch = 0; ch != CH_MAX; ch++)
+    {
+        // the lifetime energy is the only counter, counters end in _total
+        size_t n = snprintf(MetricNames[ch], sizeof(MetricNames[ch]), METRICS_PREFIX "%s%s", SE_Channels[ch].Name, ch == CH_I_AC_Energy_WH ? "_total" : "");
+
+        for (size_t i = 0; i < n && MetricNames[ch][i]; i++)
+            MetricNames[ch][i] = tolower((unsigned char)MetricNames[ch][i]);
+    }
+
+    httpd_uri_t uri = { .uri = "/metrics", .method = HTTP_GET, .handler = MetricsHandler, .user_ctx = data };
+
+    return httpd_register_uri_handler(server, &uri);
+}
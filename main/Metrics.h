@@ -0,0 +1,15 @@
+#pragma once
+
+#include <esp_err.h>
+#include <esp_http_server.h>
+
+#include "private_types.h"
+
+// tasks reported with their stack high-water mark and cpu time
+#define METRICS_MAX_TASKS 24
+
+//
+// GET /metrics in the Prometheus text format: all channels of the last sample and the health of the gateway.
+// The sample is read from TaskModbus_t::snapshot, a scrape never waits for the modbus task.
+//
+esp_err_t MetricsRegister(httpd_handle_t server, TaskModbus_t *data);
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+//
+// Sequence lock: one writer publishes a copy of T without ever waiting, any number of readers take
+// consistent copies. The sequence is odd while a write is in progress, a reader retries when the
+// sequence was odd or changed during its copy.
+//
+template <typename T> class Seqlock
+{
+public:
+    Seqlock() : seq(0) { }
+
+    // writer side, never blocks
+    void Write(const T &item)
+    {
+        uint32_t s = seq.load(std::memory_order_relaxed);
+
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        value = item;
+
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    // reader side, returns false when a write was in progress (retry later) or nothing was written yet
+    bool TryRead(T *item) const
+    {
+        uint32_t s = seq.load(std::memory_order_acquire);
+
+        if (s == 0 || (s & 1))
+            return false;
+
+        *item = value;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq.load(std::memory_order_relaxed) == s;
+    }
+
+    // number of writes so far
+    uint32_t GetVersion(void) const { return seq.load(std::memory_order_acquire) / 2; }
+
+private:
+    T value;
+    std::atomic<uint32_t> seq;
+};
@@ -4,60 +4,300 @@
  * header file for Smooth averaging class
  *
  * version 1.0 - June, 2023 ++trent m. wyatt
+ * version 2.0 - fixed capacity sliding window, templated on type and window size
+ *
+ * SmoothBank<T, N, C> keeps the last N samples of C channels in a single ring (struct-of-arrays:
+ * one row per sample, one column per channel) and provides for every channel:
+ *
+ *  - the exact moving average, using a running sum
+ *  - min / max in O(1) amortised, using monotonic deques
+ *  - optional variance (template argument V), using a running sum of squares
+ *
+ * Floating point sums are shifted around a reference value and rebuilt from the ring each time the
+ * ring wraps, so rounding errors can not accumulate (O(1) amortised).
+ *
+ * Smooth<T, N> is the single channel version with the original callback and operator interface.
+ * The lower and upper callbacks are edge triggered: they fire once when the average crosses the bound
+ * and are armed again after the average moved back by more than the hysteresis.
+ * Nothing allocates, all storage is part of the object.
  *
  */
 #ifndef SMOOTH_H_INCL
 #define SMOOTH_H_INCL
 
 #include <inttypes.h>
+#include <stddef.h>
+#include <type_traits>
 
 typedef void (*FNcallback)(double const /* new_value */);
 
-class Smooth
+template <typename T, size_t N, size_t C, bool V = false> class SmoothBank
 {
+    static_assert(N > 0 && N <= UINT16_MAX, "window size out of range");
+    static_assert(C > 0, "at least one channel required");
+    static_assert(std::is_arithmetic<T>::value, "arithmetic type required");
+
+public:
+    // accumulator type: floating point sums stay in T, integer sums are widened
+    typedef typename std::conditional<std::is_floating_point<T>::value, T, int64_t>::type acc_t;
+
 private:
-    int set_size;
-    int count;
-    FNcallback cbchange;
-    FNcallback cblower;
-    FNcallback cbupper;
+    // fixed capacity deque holding ring positions, values are looked up in the ring
+    struct Deque
+    {
+        uint16_t pos[N];
+        uint16_t front;
+        uint16_t size;
+    };
+
+    T ring[N][C];
+    acc_t sum[C];   // sum of (sample - shift) over the window
+    acc_t sumsq[C]; // sum of (sample - shift)^2 over the window, only maintained when V == true
+    T shift[C];     // reference value to keep the sums small
+    Deque minq[C];
+    Deque maxq[C];
+
+    uint16_t head; // next ring position to write
+    uint16_t fill; // number of valid samples in the ring (<= N)
+    uint32_t count;
+
+    static uint16_t next(uint16_t p) { return (p + 1 == N) ? 0 : p + 1; }
+    static uint16_t back(const Deque &q) { return q.pos[(q.front + q.size - 1) % N]; }
+    static void push_back(Deque &q, uint16_t p) { q.pos[(q.front + q.size++) % N] = p; }
+
+    // rebuild the sums around the current mean, to discard accumulated rounding errors
+    void resync(void)
+    {
+        for (size_t c = 0; c != C; c++)
+        {
+            T s = get_avg(c);
+            acc_t a = 0, aa = 0;
 
-    double avg;
-    double last;
-    double upper;
-    double lower;
+            for (size_t i = 0; i != fill; i++)
+            {
+                acc_t d = (acc_t)ring[i][c] - (acc_t)s;
+                a += d;
+                if (V)
+                    aa += d * d;
+            }
+
+            shift[c] = s;
+            sum[c] = a;
+            sumsq[c] = aa;
+        }
+    }
 
 public:
-    Smooth(int const window = 1, int const c = 0, double const a = 0.0);
+    SmoothBank() { reset(); }
 
-    // callback registration:
-    void set_change(FNcallback const cb);
-    void set_lower(FNcallback const cb, double const value);
-    void set_upper(FNcallback const cb, double const value);
+    // reset the smoothing object
+    void reset(void)
+    {
+        for (size_t c = 0; c != C; c++)
+        {
+            sum[c] = 0;
+            sumsq[c] = 0;
+            shift[c] = 0;
+            minq[c].front = minq[c].size = 0;
+            maxq[c].front = maxq[c].size = 0;
+        }
+
+        head = 0;
+        fill = 0;
+        count = 0;
+    }
+
+    // add one sample for every channel
+    void add(const T *val)
+    {
+        bool full = (fill == N);
+
+        if (fill == 0)
+        {
+            for (size_t c = 0; c != C; c++)
+                shift[c] = val[c];
+        }
+
+        for (size_t c = 0; c != C; c++)
+        {
+            Deque &mn = minq[c];
+            Deque &mx = maxq[c];
+
+            if (full)
+            {
+                acc_t d = (acc_t)ring[head][c] - (acc_t)shift[c];
+                sum[c] -= d;
+                if (V)
+                    sumsq[c] -= d * d;
+
+                // the oldest sample leaves the window
+                if (mn.size && mn.pos[mn.front] == head)
+                {
+                    mn.front = next(mn.front);
+                    mn.size--;
+                }
+                if (mx.size && mx.pos[mx.front] == head)
+                {
+                    mx.front = next(mx.front);
+                    mx.size--;
+                }
+            }
+
+            T v = val[c];
+            ring[head][c] = v;
+
+            acc_t d = (acc_t)v - (acc_t)shift[c];
+            sum[c] += d;
+            if (V)
+                sumsq[c] += d * d;
+
+            while (mn.size && ring[back(mn)][c] >= v)
+                mn.size--;
+            push_back(mn, head);
+
+            while (mx.size && ring[back(mx)][c] <= v)
+                mx.size--;
+            push_back(mx, head);
+        }
+
+        if (!full)
+            fill++;
+
+        count++;
+        head = next(head);
+
+        if (std::is_floating_point<T>::value && head == 0)
+            resync();
+    }
 
     // get the current running average
-    double get_avg() const;
+    T get_avg(size_t c = 0) const { return fill ? (T)((acc_t)shift[c] + sum[c] / (acc_t)fill) : 0; }
+
+    // get the smallest sample in the window
+    T get_min(size_t c = 0) const { return minq[c].size ? ring[minq[c].pos[minq[c].front]][c] : 0; }
+
+    // get the largest sample in the window
+    T get_max(size_t c = 0) const { return maxq[c].size ? ring[maxq[c].pos[maxq[c].front]][c] : 0; }
+
+    // get the (population) variance over the window, requires V == true
+    T get_variance(size_t c = 0) const
+    {
+        static_assert(V, "variance not enabled for this SmoothBank");
+
+        if (fill == 0)
+            return 0;
+
+        acc_t m = sum[c] / (acc_t)fill;
+        acc_t var = sumsq[c] / (acc_t)fill - m * m;
+
+        return (T)(var < 0 ? 0 : var);
+    }
 
     // get the total sample count
-    int get_count() const;
+    uint32_t get_count() const { return count; }
+
+    // get the number of samples currently in the window
+    size_t get_fill() const { return fill; }
+
+    // get the window size (num samples)
+    static constexpr size_t get_window() { return N; }
+};
+
+template <typename T, size_t N, bool V = false> class Smooth : public SmoothBank<T, N, 1, V>
+{
+private:
+    FNcallback cbchange;
+    FNcallback cblower;
+    FNcallback cbupper;
+
+    T last;
+    T upper;
+    T lower;
+    T upper_hyst;
+    T lower_hyst;
+    bool below; // the lower callback fired and is not armed again yet
+    bool above; // the upper callback fired and is not armed again yet
+
+public:
+    Smooth() : cbchange(nullptr), cblower(nullptr), cbupper(nullptr), last(0), upper(0), lower(0), upper_hyst(0), lower_hyst(0), below(false), above(false) { }
+
+    // callback registration:
+    void set_change(FNcallback const cb) { cbchange = cb; }
 
-    // get the current window size (num samples)
-    int get_window() const;
+    void set_lower(FNcallback const cb, T const value, T const hysteresis = 0)
+    {
+        cblower = cb;
+        lower = value;
+        lower_hyst = hysteresis;
+        below = false;
+    }
 
-    // set the current window size (num samples)
-    void set_window(int const size);
+    void set_upper(FNcallback const cb, T const value, T const hysteresis = 0)
+    {
+        cbupper = cb;
+        upper = value;
+        upper_hyst = hysteresis;
+        above = false;
+    }
 
     // reset the smoothing object
-    void reset(int const window);
+    void reset(void)
+    {
+        SmoothBank<T, N, 1, V>::reset();
+
+        last = 0;
+        lower = 0;
+        upper = 0;
+        lower_hyst = 0;
+        upper_hyst = 0;
+        below = false;
+        above = false;
+        cbchange = nullptr;
+        cblower = nullptr;
+        cbupper = nullptr;
+    }
 
     // add a sample to the set and return the running average
-    double add(double const val);
+    T add(T const val)
+    {
+        SmoothBank<T, N, 1, V>::add(&val);
+
+        T avg = this->get_avg();
+
+        if (last != avg)
+        {
+            last = avg;
+
+            if (nullptr != cbchange)
+                cbchange(avg);
+
+            if (!below && avg < lower)
+            {
+                below = true;
+                if (nullptr != cblower)
+                    cblower(avg);
+            }
+            else if (below && avg >= lower + lower_hyst)
+                below = false;
+
+            if (!above && avg >= upper)
+            {
+                above = true;
+                if (nullptr != cbupper)
+                    cbupper(avg);
+            }
+            else if (above && avg < upper - upper_hyst)
+                above = false;
+        }
+
+        return avg;
+    }
 
     // operator overload for +=
-    double operator+=(double const term);
+    T operator+=(T const term) { return add(term); }
 
     // operator overload for ()
-    double operator()();
+    T operator()() const { return this->get_avg(); }
 
 }; // class Smooth
 
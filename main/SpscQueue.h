@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+//
+// Lock free, fixed capacity queue for a single producer and a single consumer task.
+// N must be a power of two, one slot is never used to tell a full queue from an empty one.
+//
+template <typename T, size_t N> class SpscQueue
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "capacity must be a power of two");
+
+public:
+    SpscQueue() : head(0), tail(0) { }
+
+    // producer side, returns false when the queue is full
+    bool Push(const T &item)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t n = (h + 1) & (N - 1);
+
+        if (n == tail.load(std::memory_order_acquire))
+            return false;
+
+        slots[h] = item;
+        head.store(n, std::memory_order_release);
+
+        return true;
+    }
+
+    // consumer side, returns false when the queue is empty
+    bool Pop(T *item)
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+
+        if (t == head.load(std::memory_order_acquire))
+            return false;
+
+        *item = slots[t];
+        tail.store((t + 1) & (N - 1), std::memory_order_release);
+
+        return true;
+    }
+
+    bool Empty(void) const { return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire); }
+
+private:
+    T slots[N];
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> tail;
+};
@@ -0,0 +1,61 @@
+#include "Statistics.h"
+
+Statistics::Statistics(const SEChannel_t *channels, uint8_t num_channels)
+{
+    if (num_channels > MAX_CHANNELS)
+        num_channels = MAX_CHANNELS;
+
+    for (uint8_t i = 0; i != num_channels; i++)
+        _channels[i] = channels[i];
+
+    _num_channels = num_channels;
+    _window = STATS_DEFAULT_WINDOW;
+    _start = 0;
+}
+
+esp_err_t Statistics::SetWindow(uint32_t seconds)
+{
+    // windows that do not divide a day would not start at midnight every day
+    if (seconds == 0 || seconds > 86400 || (86400 % seconds) != 0)
+        return ESP_ERR_INVALID_ARG;
+
+    _window = seconds;
+
+    return ESP_OK;
+}
+
+uint32_t Statistics::GetWindow(void) const { return _window; }
+
+time_t Statistics::WindowStart(time_t now) const
+{
+    struct tm ltm;
+
+    localtime_r(&now, &ltm);
+    time_t sod = ltm.tm_hour * 3600 + ltm.tm_min * 60 + ltm.tm_sec;
+
+    return now - (sod % _window);
+}
+
+bool Statistics::WindowClosed(time_t now) const { return WindowStart(now) != _start; }
+
+void Statistics::Reset(time_t now)
+{
+    _start = WindowStart(now);
+
+    for (uint8_t i = 0; i != _num_channels; i++)
+        _digests[i].Reset();
+}
+
+void Statistics::Add(const SolarEdge_t *se)
+{
+    for (uint8_t i = 0; i != _num_channels; i++)
+        _digests[i].Add(SE_ChannelValue(se, _channels[i]));
+}
+
+time_t Statistics::GetWindowStart(void) const { return _start; }
+
+uint8_t Statistics::GetNumChannels(void) const { return _num_channels; }
+
+SEChannel_t Statistics::GetChannel(uint8_t i) const { return _channels[i]; }
+
+TDigest *Statistics::GetDigest(uint8_t i) { return &_digests[i]; }
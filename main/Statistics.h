@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+#include <esp_err.h>
+
+#include "sunspec.h"
+#include "Channels.h"
+#include "TDigest.h"
+
+// default length of a statistics window: a day, starting at local midnight
+#define STATS_DEFAULT_WINDOW 86400
+
+//
+// Streaming percentiles for a selection of channels, over windows aligned to local midnight.
+// The window must divide a day (e.g. 3600, 21600, 86400).
+//
+class Statistics
+{
+public:
+    Statistics(const SEChannel_t *channels, uint8_t num_channels);
+
+    // ESP_ERR_INVALID_ARG, and the window is kept, when seconds does not divide a day
+    esp_err_t SetWindow(uint32_t seconds);
+    uint32_t GetWindow(void) const;
+
+    // true when now is past the end of the current window
+    bool WindowClosed(time_t now) const;
+
+    // start a new window containing now
+    void Reset(time_t now);
+
+    void Add(const SolarEdge_t *se);
+
+    time_t GetWindowStart(void) const;
+    uint8_t GetNumChannels(void) const;
+    SEChannel_t GetChannel(uint8_t i) const;
+    TDigest *GetDigest(uint8_t i);
+
+private:
+    static const uint8_t MAX_CHANNELS = 8;
+
+    SEChannel_t _channels[MAX_CHANNELS];
+    TDigest _digests[MAX_CHANNELS];
+    uint8_t _num_channels;
+
+    uint32_t _window;
+    time_t _start;
+
+    time_t WindowStart(time_t now) const;
+};
@@ -0,0 +1,159 @@
+#include <math.h>
+
+#include "TDigest.h"
+
+// scale function k1 and its inverse, k runs from -compression/4 to +compression/4
+#define K_SCALE ((float)TDIGEST_COMPRESSION / (2.0f * (float)M_PI))
+
+static inline float k_of_q(float q) { return K_SCALE * asinf(2.0f * q - 1.0f); }
+
+static inline float q_of_k(float k)
+{
+    if (k >= (float)TDIGEST_COMPRESSION / 4.0f)
+        return 1.0f;
+
+    return (sinf(k / K_SCALE) + 1.0f) / 2.0f;
+}
+
+TDigest::TDigest() { Reset(); }
+
+void TDigest::Reset(void)
+{
+    _num_centroids = 0;
+    _num_buffered = 0;
+
+    _count = 0;
+    _sum = 0;
+    _min = NAN;
+    _max = NAN;
+}
+
+void TDigest::Add(float value)
+{
+    if (isnan(value))
+        return;
+
+    if (_count == 0 || value < _min)
+        _min = value;
+    if (_count == 0 || value > _max)
+        _max = value;
+
+    _count++;
+    _sum += value;
+
+    _buffer[_num_buffered++] = value;
+    if (_num_buffered == TDIGEST_BUFFER)
+        Merge();
+}
+
+void TDigest::Merge(void)
+{
+    static Centroid_t scratch[TDIGEST_COMPRESSION + TDIGEST_BUFFER];
+
+    if (_num_buffered == 0)
+        return;
+
+    // insertion sort of the (small) buffer
+    for (uint16_t i = 1; i < _num_buffered; i++)
+    {
+        float v = _buffer[i];
+        int16_t j = i - 1;
+
+        while (j >= 0 && _buffer[j] > v)
+        {
+            _buffer[j + 1] = _buffer[j];
+            j--;
+        }
+        _buffer[j + 1] = v;
+    }
+
+    // merge the sorted buffer with the sorted centroids
+    uint16_t a = 0, b = 0, n = 0;
+    float total = 0;
+
+    while (a < _num_centroids || b < _num_buffered)
+    {
+        if (b == _num_buffered || (a < _num_centroids && _centroids[a].mean <= _buffer[b]))
+            scratch[n] = _centroids[a++];
+        else
+            scratch[n] = { _buffer[b++], 1.0f };
+
+        total += scratch[n++].weight;
+    }
+
+    // compress: combine neighbours as long as the centroid spans at most one unit of k
+    Centroid_t cur = scratch[0];
+    float so_far = 0;
+    float q_limit = q_of_k(k_of_q(0) + 1.0f) * total;
+
+    _num_centroids = 0;
+
+    for (uint16_t i = 1; i < n; i++)
+    {
+        if (so_far + cur.weight + scratch[i].weight <= q_limit || _num_centroids == TDIGEST_COMPRESSION - 1)
+        {
+            cur.weight += scratch[i].weight;
+            cur.mean += (scratch[i].mean - cur.mean) * scratch[i].weight / cur.weight;
+        }
+        else
+        {
+            _centroids[_num_centroids++] = cur;
+            so_far += cur.weight;
+            q_limit = q_of_k(k_of_q(so_far / total) + 1.0f) * total;
+            cur = scratch[i];
+        }
+    }
+
+    _centroids[_num_centroids++] = cur;
+    _num_buffered = 0;
+}
+
+float TDigest::Quantile(float q)
+{
+    Merge();
+
+    if (_num_centroids == 0)
+        return NAN;
+
+    if (q <= 0)
+        return _min;
+    if (q >= 1)
+        return _max;
+    if (_num_centroids == 1)
+        return _centroids[0].mean;
+
+    float index = q * _count;
+
+    // left tail, between the minimum and the centre of the first centroid
+    const Centroid_t &first = _centroids[0];
+    if (index < first.weight / 2)
+        return _min + (first.mean - _min) * index / (first.weight / 2);
+
+    // between the centres of two neighbouring centroids
+    float centre = first.weight / 2;
+    for (uint16_t i = 0; i + 1 < _num_centroids; i++)
+    {
+        const Centroid_t &l = _centroids[i];
+        const Centroid_t &r = _centroids[i + 1];
+        float gap = (l.weight + r.weight) / 2;
+
+        if (index < centre + gap)
+            return l.mean + (r.mean - l.mean) * (index - centre) / gap;
+
+        centre += gap;
+    }
+
+    // right tail, between the centre of the last centroid and the maximum
+    const Centroid_t &last = _centroids[_num_centroids - 1];
+    float rest = _count - centre;
+
+    return (rest > 0) ? last.mean + (_max - last.mean) * (index - centre) / rest : _max;
+}
+
+uint32_t TDigest::Count(void) const { return _count; }
+
+float TDigest::Min(void) const { return _min; }
+
+float TDigest::Max(void) const { return _max; }
+
+float TDigest::Mean(void) const { return _count ? _sum / _count : NAN; }
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+// compression: upper bound for the number of centroids, trades memory for accuracy
+#define TDIGEST_COMPRESSION 100
+
+// number of samples collected before they are merged into the centroids
+#define TDIGEST_BUFFER 32
+
+//
+// Merging t-digest (Dunning & Ertl) with the k1 (arcsine) scale function.
+// Fixed memory (about 1 KB) and O(1) amortised per sample, quantiles near 0 and 1 are the most accurate.
+//
+// The merge uses a scratch buffer shared by all instances: only use digests from a single task.
+//
+class TDigest
+{
+public:
+    TDigest();
+
+    void Reset(void);
+    void Add(float value);
+
+    // estimated value at quantile q (0..1), NAN without samples
+    float Quantile(float q);
+
+    uint32_t Count(void) const;
+    float Min(void) const;
+    float Max(void) const;
+    float Mean(void) const;
+
+private:
+    typedef struct
+    {
+        float mean;
+        float weight;
+    } Centroid_t;
+
+    Centroid_t _centroids[TDIGEST_COMPRESSION];
+    float _buffer[TDIGEST_BUFFER];
+
+    uint16_t _num_centroids;
+    uint16_t _num_buffered;
+
+    uint32_t _count;
+    double _sum;
+    float _min;
+    float _max;
+
+    void Merge(void);
+};
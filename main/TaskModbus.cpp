@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
+#include <sys/time.h>
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -8,15 +10,19 @@
 #include <esp_log.h>
 #include <esp_system.h>
 #include <esp_err.h>
+#include <esp_timer.h>
 
 #include "TaskModbus.h"
 #include "private_types.h"
+#include "Energy.h"
 
 #define TAG "TaskModbus"
 
 void TaskModbus(void *param)
 {
     TaskModbus_t *data = (TaskModbus_t *)param;
+    static EnergyIntegrator energy;
+    struct timeval tv;
 
     while (data->mb->Connect() != ESP_OK)
     {
@@ -28,26 +34,52 @@ void TaskModbus(void *param)
 
     while (true)
     {
-        vTaskDelay(pdMS_TO_TICKS(MODBUS_QUERY_DELAY));
+        bool burst = (uint32_t)(esp_timer_get_time() / 1000000LL) < data->burst_end;
+
+        vTaskDelay(pdMS_TO_TICKS(burst ? MODBUS_BURST_DELAY : data->query_delay));
 
         if (!data->mb->is_connected())
         {
             ESP_LOGI(TAG, "Disconnected");
-            data->mb->Connect();
+            if (data->mb->Connect() == ESP_OK)
+                data->mbstats.reconnects++;
         }
 
+        int64_t start = esp_timer_get_time();
         esp_err_t error = data->mb->ReadRegisters(data->sunspec);
 
         if (error != ESP_OK)
         {
             ESP_LOGI(TAG, "Read error: %d", error);
             data->mb->Close();
+            data->mbstats.errors++;
 
             continue;
         }
 
+        uint32_t rtt = (uint32_t)(esp_timer_get_time() - start);
+
+        data->mbstats.requests++;
+        data->mbstats.rtt_us = rtt;
+        if (rtt > data->mbstats.rtt_max_us)
+            data->mbstats.rtt_max_us = rtt;
+
+        gettimeofday(&tv, NULL);
         data->mb->ConvertRegisters(data->sunspec, data->solaredge);
 
+        SolarEdge_t *se = data->solaredge;
+        se->Timestamp = (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+
+        energy.Add(esp_timer_get_time(), se->I_AC_Power, se->I_DC_Power, se->I_AC_Energy_WH);
+        se->I_AC_Energy_WH_Frac = energy.GetOffset();
+        se->I_DC_AC_Efficiency = energy.GetEfficiency();
+
+        time_t now = tv.tv_sec;
+        for (uint8_t i = 0; i != data->num_aggregators; i++)
+            data->aggregators[i]->Add(now, se);
+
+        data->snapshot.Write(*se);
+
         xSemaphoreGive(data->lock);
     }
 }
@@ -9,9 +9,12 @@
 #include "sunspec.h"
 
 //
-// number of milliseconds between requesting new data.
+// default number of milliseconds between requesting new data, see TaskModbus_t::query_delay.
 // According to sunspec-implementation-technical-note.pdf Appendix B, the update frequency can be 1 second.
 //
 #define MODBUS_QUERY_DELAY (1000)
 
+// number of milliseconds between requests during a burst
+#define MODBUS_BURST_DELAY (200)
+
 void TaskModbus(void *param);
@@ -0,0 +1,97 @@
+#include <stdio.h>
+
+#include <cJSON.h>
+
+#include "Telemetry.h"
+#include "Cbor.h"
+#include "TextWriter.h"
+
+size_t TelemetryEncodeCBOR(const SolarEdge_t *se, int64_t uptime, uint8_t *buf, size_t size)
+{
+    CborWriter cbor(buf, size);
+
+    cbor.Map(6 + CH_MAX);
+
+    cbor.Uint(TM_KEY_SCHEMA);
+    cbor.Uint(TELEMETRY_SCHEMA_VERSION);
+    cbor.Uint(TM_KEY_TIMESTAMP);
+    cbor.Uint((uint64_t)(se->Timestamp / 1000));
+    cbor.Uint(TM_KEY_UPTIME);
+    cbor.Uint((uint64_t)uptime);
+    cbor.Uint(TM_KEY_STATUS);
+    cbor.Uint(se->I_Status);
+    cbor.Uint(TM_KEY_STATUS_VENDOR);
+    cbor.Uint(se->I_Status_Vendor);
+    cbor.Uint(TM_KEY_ENERGY_24H);
+    cbor.Float(SE_EnergyToday(se));
+
+    for (int ch = 0; ch != CH_MAX; ch++)
+    {
+        cbor.Uint(TM_KEY_CHANNEL + ch);
+        cbor.Float(se->*SE_Channels[ch].Value);
+    }
+
+    return cbor.Overflow() ? 0 : cbor.Length();
+}
+
+size_t TelemetryEncodeJSON(const SolarEdge_t *se, int64_t uptime, char *buf, size_t size)
+{
+    TextWriter out(buf, size);
+
+    out.Printf("{\"timestamp\":%lld,\"esp_uptime\":%lld", (long long)(se->Timestamp / 1000), (long long)uptime);
+
+    for (int ch = 0; ch != CH_MAX; ch++)
+    {
+        out.Printf(",\"%s\":", SE_Channels[ch].Name);
+        out.Number(se->*SE_Channels[ch].Value);
+    }
+
+    out.Printf(",\"I_AC_Energy_WH_24H\":");
+    out.Number(SE_EnergyToday(se));
+    out.Printf(",\"I_Status\":%u,\"I_Status_Vendor\":%u}", (unsigned)se->I_Status, (unsigned)se->I_Status_Vendor);
+
+    return out.Overflow() ? 0 : out.Length();
+}
+
+static void AddKey(cJSON *keys, int key, const char *name, const char *type, const char *unit)
+{
+    char buf[8];
+    cJSON *item = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(item, "name", cJSON_CreateString(name));
+    cJSON_AddItemToObject(item, "type", cJSON_CreateString(type));
+    if (unit)
+        cJSON_AddItemToObject(item, "unit", cJSON_CreateString(unit));
+
+    snprintf(buf, sizeof(buf), "%d", key);
+    cJSON_AddItemToObject(keys, buf, item);
+}
+
+char *TelemetrySchemaJSON(void)
+{
+    cJSON *jsDOC = cJSON_CreateObject();
+    if (!jsDOC)
+        return nullptr;
+
+    cJSON *keys = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(jsDOC, "encoding", cJSON_CreateString("cbor"));
+    cJSON_AddItemToObject(jsDOC, "version", cJSON_CreateNumber(TELEMETRY_SCHEMA_VERSION));
+
+    AddKey(keys, TM_KEY_SCHEMA, "schema", "uint", nullptr);
+    AddKey(keys, TM_KEY_TIMESTAMP, "timestamp", "uint", "ms");
+    AddKey(keys, TM_KEY_UPTIME, "esp_uptime", "uint", "s");
+    AddKey(keys, TM_KEY_STATUS, "I_Status", "uint", nullptr);
+    AddKey(keys, TM_KEY_STATUS_VENDOR, "I_Status_Vendor", "uint", nullptr);
+    AddKey(keys, TM_KEY_ENERGY_24H, "I_AC_Energy_WH_24H", "float", "Wh");
+
+    for (int ch = 0; ch != CH_MAX; ch++)
+        AddKey(keys, TM_KEY_CHANNEL + ch, SE_Channels[ch].Name, "float", SE_Channels[ch].Unit);
+
+    cJSON_AddItemToObject(jsDOC, "keys", keys);
+
+    char *str = cJSON_PrintUnformatted(jsDOC);
+    cJSON_Delete(jsDOC);
+
+    return str;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sunspec.h"
+#include "Channels.h"
+
+//
+// Compact binary telemetry: a CBOR map with small integer keys from a fixed schema.
+// Bump the version whenever a key changes meaning, consumers get the schema from <topic>/cbor/schema.
+//
+#define TELEMETRY_SCHEMA_VERSION 1
+
+// a sample encodes to about 170 bytes, leave room for future keys
+#define TELEMETRY_MAX_SIZE 256
+
+enum {
+    TM_KEY_SCHEMA = 0,        // uint, TELEMETRY_SCHEMA_VERSION
+    TM_KEY_TIMESTAMP = 1,     // uint, capture time in milliseconds since epoch
+    TM_KEY_UPTIME = 2,        // uint, seconds since boot of the gateway
+    TM_KEY_STATUS = 3,        // uint, I_Status
+    TM_KEY_STATUS_VENDOR = 4, // uint, I_Status_Vendor
+    TM_KEY_ENERGY_24H = 5,    // float, Wh produced today
+    TM_KEY_CHANNEL = 16,      // float, TM_KEY_CHANNEL + SEChannel_t for all channels in SE_Channels
+};
+
+// encode a sample, returns the number of bytes used or 0 when the buffer is too small
+size_t TelemetryEncodeCBOR(const SolarEdge_t *se, int64_t uptime, uint8_t *buf, size_t size);
+
+// compact json snapshot of a sample with the names of the json document, returns the length or 0 when the buffer is too small
+size_t TelemetryEncodeJSON(const SolarEdge_t *se, int64_t uptime, char *buf, size_t size);
+
+// json description of the keys, free() the result
+char *TelemetrySchemaJSON(void);
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+
+//
+// bounded append-only text buffer, remembers an overflow instead of truncating silently
+//
+class TextWriter
+{
+public:
+    TextWriter(char *buf, size_t size) : _buf(buf), _size(size), _len(0), _overflow(size == 0) { }
+
+    void Printf(const char *fmt, ...)
+    {
+        if (_overflow)
+            return;
+
+        va_list args;
+        va_start(args, fmt);
+        int n = vsnprintf(_buf + _len, _size - _len, fmt, args);
+        va_end(args);
+
+        if (n < 0 || (size_t)n >= _size - _len)
+            _overflow = true;
+        else
+            _len += n;
+    }
+
+    // two decimals without trailing zeros: 230.10 -> 230.1, 0.00 -> 0
+    void Number(float value)
+    {
+        size_t start = _len;
+
+        Printf("%.2f", value);
+        if (_overflow)
+            return;
+
+        while (_len > start && _buf[_len - 1] == '0')
+            _len--;
+        if (_buf[_len - 1] == '.')
+            _len--;
+        if (_len - start == 2 && _buf[start] == '-' && _buf[start + 1] == '0')
+            _buf[start] = '0', _len--;
+
+        _buf[_len] = '\0';
+    }
+
+    // json string, with quotes and backslashes escaped and trailing spaces (register padding) removed
+    void String(const char *value)
+    {
+        size_t n = strlen(value);
+
+        while (n && value[n - 1] == ' ')
+            n--;
+
+        Printf("\"");
+        for (size_t i = 0; i != n && !_overflow; i++)
+        {
+            if (value[i] == '"' || value[i] == '\\')
+                Printf("\\%c", value[i]);
+            else if ((unsigned char)value[i] >= ' ')
+                Printf("%c", value[i]);
+        }
+        Printf("\"");
+    }
+
+    size_t Length(void) const { return _len; }
+    bool Overflow(void) const { return _overflow; }
+
+private:
+    char *_buf;
+    size_t _size;
+    size_t _len;
+    bool _overflow;
+};
@@ -0,0 +1,235 @@
+#include <string.h>
+#include <atomic>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include "WsStream.h"
+#include "Telemetry.h"
+
+#define TAG "WsStream"
+
+typedef struct
+{
+    int fd;    // socket of the client, -1 for a free slot
+    bool json; // text frames with compact json instead of binary cbor
+    uint8_t head;
+    uint8_t count;
+    uint16_t len[WS_QUEUE_FRAMES];
+    uint8_t frames[WS_QUEUE_FRAMES][WS_FRAME_SIZE];
+} WsClient_t;
+
+static httpd_handle_t WsServer = nullptr;
+static SemaphoreHandle_t WsLock = nullptr; // protects WsClients, only held to copy a frame
+static WsClient_t WsClients[WS_MAX_CLIENTS];
+static std::atomic<bool> WsSendQueued(false);
+static std::atomic<uint32_t> WsDropped(0);
+
+static void RemoveClient(int fd)
+{
+    xSemaphoreTake(WsLock, portMAX_DELAY);
+    for (int i = 0; i != WS_MAX_CLIENTS; i++)
+    {
+        if (WsClients[i].fd == fd)
+            WsClients[i].fd = -1;
+    }
+    xSemaphoreGive(WsLock);
+}
+
+//
+// runs in the http server task: send the queued frames of all clients
+//
+static void WsSend(void *arg)
+{
+    static uint8_t frame_buf[WS_FRAME_SIZE];
+
+    WsSendQueued = false;
+
+    for (int i = 0; i != WS_MAX_CLIENTS; i++)
+    {
+        WsClient_t *client = &WsClients[i];
+
+        while (true)
+        {
+            httpd_ws_frame_t frame;
+            int fd;
+
+            xSemaphoreTake(WsLock, portMAX_DELAY);
+
+            fd = client->fd;
+            if (fd < 0 || client->count == 0)
+            {
+                xSemaphoreGive(WsLock);
+                break;
+            }
+
+            memset(&frame, 0, sizeof(frame));
+            frame.type = client->json ? HTTPD_WS_TYPE_TEXT : HTTPD_WS_TYPE_BINARY;
+            frame.len = client->len[client->head];
+            frame.payload = frame_buf;
+            memcpy(frame_buf, client->frames[client->head], frame.len);
+
+            client->head = (client->head + 1) % WS_QUEUE_FRAMES;
+            client->count--;
+
+            xSemaphoreGive(WsLock);
+
+            if (httpd_ws_get_fd_info(WsServer, fd) != HTTPD_WS_CLIENT_WEBSOCKET || httpd_ws_send_frame_async(WsServer, fd, &frame) != ESP_OK)
+            {
+                ESP_LOGI(TAG, "client %d gone", fd);
+                RemoveClient(fd);
+                httpd_sess_trigger_close(WsServer, fd);
+                break;
+            }
+        }
+    }
+}
+
+static esp_err_t WsHandler(httpd_req_t *req)
+{
+    // the handshake: register the client
+    if (req->method == HTTP_GET)
+    {
+        char query[32], format[8];
+        bool json = false;
+        int fd = httpd_req_to_sockfd(req);
+
+        if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK && httpd_query_key_value(query, "format", format, sizeof(format)) == ESP_OK)
+            json = (strcmp(format, "json") == 0);
+
+        xSemaphoreTake(WsLock, portMAX_DELAY);
+
+        int slot = -1;
+        for (int i = 0; i != WS_MAX_CLIENTS && slot < 0; i++)
+        {
+            if (WsClients[i].fd < 0 || WsClients[i].fd == fd)
+                slot = i;
+        }
+
+        if (slot >= 0)
+        {
+            WsClients[slot].fd = fd;
+            WsClients[slot].json = json;
+            WsClients[slot].head = 0;
+            WsClients[slot].count = 0;
+        }
+
+        xSemaphoreGive(WsLock);
+
+        if (slot < 0)
+        {
+            ESP_LOGI(TAG, "too many clients");
+            return ESP_FAIL;
+        }
+
+        ESP_LOGI(TAG, "client %d connected (%s)", fd, json ? "json" : "cbor");
+        return ESP_OK;
+    }
+
+    // frames from the client are not used, read and discard them
+    uint8_t buf[32];
+    httpd_ws_frame_t frame;
+
+    memset(&frame, 0, sizeof(frame));
+    if (httpd_ws_recv_frame(req, &frame, 0) != ESP_OK)
+        return ESP_FAIL;
+
+    for (size_t left = frame.len; left;)
+    {
+        frame.payload = buf;
+        frame.len = (left < sizeof(buf)) ? left : sizeof(buf);
+
+        if (httpd_ws_recv_frame(req, &frame, frame.len) != ESP_OK)
+            return ESP_FAIL;
+
+        left -= frame.len;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t WsStreamRegister(httpd_handle_t server)
+{
+    if (!server)
+        return ESP_ERR_INVALID_ARG;
+
+    WsLock = xSemaphoreCreateMutex();
+    for (int i = 0; i != WS_MAX_CLIENTS; i++)
+        WsClients[i].fd = -1;
+
+    WsServer = server;
+
+    httpd_uri_t uri = { .uri = "/ws", .method = HTTP_GET, .handler = WsHandler, .user_ctx = nullptr, .is_websocket = true };
+
+    return httpd_register_uri_handler(server, &uri);
+}
+
+static void Enqueue(WsClient_t *client, const uint8_t *data, size_t len)
+{
+    if (client->count == WS_QUEUE_FRAMES)
+    {
+        client->head = (client->head + 1) % WS_QUEUE_FRAMES;
+        client->count--;
+        WsDropped++;
+    }
+
+    uint8_t tail = (client->head + client->count) % WS_QUEUE_FRAMES;
+
+    memcpy(client->frames[tail], data, len);
+    client->len[tail] = len;
+    client->count++;
+}
+
+void WsStreamPush(const SolarEdge_t *se)
+{
+    static uint8_t cbor_buf[TELEMETRY_MAX_SIZE];
+    static char json_buf[WS_FRAME_SIZE];
+    size_t cbor_len = 0, json_len = 0;
+    bool active = false;
+
+    if (!WsServer)
+        return;
+
+    int64_t uptime = esp_timer_get_time() / (1000 * 1000);
+
+    xSemaphoreTake(WsLock, portMAX_DELAY);
+
+    for (int i = 0; i != WS_MAX_CLIENTS; i++)
+    {
+        WsClient_t *client = &WsClients[i];
+
+        if (client->fd < 0)
+            continue;
+
+        // every format is encoded once, for the first client that wants it
+        if (client->json)
+        {
+            if (json_len == 0)
+                json_len = TelemetryEncodeJSON(se, uptime, json_buf, sizeof(json_buf));
+            if (json_len)
+                Enqueue(client, (const uint8_t *)json_buf, json_len);
+        }
+        else
+        {
+            if (cbor_len == 0)
+                cbor_len = TelemetryEncodeCBOR(se, uptime, cbor_buf, sizeof(cbor_buf));
+            if (cbor_len)
+                Enqueue(client, cbor_buf, cbor_len);
+        }
+
+        active = true;
+    }
+
+    xSemaphoreGive(WsLock);
+
+    if (active && !WsSendQueued.exchange(true))
+    {
+        if (httpd_queue_work(WsServer, WsSend, nullptr) != ESP_OK)
+            WsSendQueued = false;
+    }
+}
+
+uint32_t WsStreamDropped(void) { return WsDropped; }
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <esp_err.h>
+#include <esp_http_server.h>
+
+#include "sunspec.h"
+
+#define WS_MAX_CLIENTS  4
+#define WS_QUEUE_FRAMES 4    // per client, the oldest frame is dropped when a client can not keep up
+#define WS_FRAME_SIZE   1024 // a compact json sample is at most about 700 bytes, cbor about 170
+
+//
+// GET /ws: every sample is pushed to all connected websocket clients, as binary cbor frames (see Telemetry.h)
+// or, with /ws?format=json, as compact json text frames. Frames are queued per client and sent by the http
+// server task, a slow client only loses its own oldest frames.
+//
+esp_err_t WsStreamRegister(httpd_handle_t server);
+
+// called for every sample, never waits for a client
+void WsStreamPush(const SolarEdge_t *se);
+
+// frames dropped for slow clients
+uint32_t WsStreamDropped(void);
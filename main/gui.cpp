@@ -1,4 +1,5 @@
 #include <time.h>
+#include <string.h>
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -8,17 +9,11 @@
 
 #include "lcd.h"
 #include "gui.h"
-
-#include "Smooth.h"
+#include "ImageCache.h"
+#include "Channels.h"
 
 #define TAG "gui"
 
-LV_IMG_DECLARE(se_logo);
-LV_IMG_DECLARE(se_state_1);
-LV_IMG_DECLARE(se_state_4);
-LV_IMG_DECLARE(se_state_5);
-
-#define NUM_MEASUREMENTS 60
 #define PANEL_HEIGHT     354
 #define PANEL_OFFSET     104
 #define CHART_OFFSET     -16
@@ -42,6 +37,37 @@ void WattToUnits(char *buf, double watts)
     sprintf(buf, "%.2f %s", watts, units[unitIndex]);
 }
 
+//
+// Widgets are only touched when their value changed: every set invalidates the area of the widget,
+// even when the text is the same, and LVGL renders it again.
+//
+static void LabelSetText(lv_obj_t *label, const char *text)
+{
+    if (strcmp(lv_label_get_text(label), text) != 0)
+        lv_label_set_text(label, text);
+}
+
+static void ArcSetValue(lv_obj_t *arc, int16_t value)
+{
+    if (lv_arc_get_value(arc) != value)
+        lv_arc_set_value(arc, value);
+}
+
+static void ImgSetSrc(lv_obj_t *img, const void *src)
+{
+    if (lv_img_get_src(img) != src)
+        lv_img_set_src(img, src);
+}
+
+// turn the backlight on, also called by the lvgl task for a touch while the screen is off
+static void ScreenWake(void *ctx)
+{
+    GuiData_t *gd = (GuiData_t *)ctx;
+
+    gd->BackLightActive = 30;
+    xSemaphoreGive(gd->BackLightChange);
+}
+
 void ui_event_Screen(lv_event_t *e)
 {
     lv_event_code_t event_code = lv_event_get_code(e);
@@ -52,107 +78,177 @@ void ui_event_Screen(lv_event_t *e)
         if (gd->BackLightActive)
             GUI_TogglePanel(gd);
         else
-        {
-            gd->BackLightActive = 30;
-            xSemaphoreGive(gd->BackLightChange);
-        }
+            ScreenWake(gd);
     }
 }
 
-static void DrawGradient(lv_event_t *e)
+//
+// the time labels of the x axis of a chart. They only move when a bucket closes, so they are formatted then
+// and the draw callbacks only look them up. The last tick is "now".
+//
+typedef struct
 {
-    lv_obj_draw_part_dsc_t *dsc = (lv_obj_draw_part_dsc_t *)lv_event_get_param(e);
+    uint32_t interval; // seconds per bucket of the chart
+    uint32_t spacing;  // seconds between two ticks
+    uint8_t count;
+    time_t bucket; // the labels are valid during this bucket
+    char text[NUM_TICKS_X_24H][6];
+} TickLabels_t;
+
+static TickLabels_t Ticks_24H = { CHART_24H_INTERVAL, 7200, NUM_TICKS_X_24H, -1, {} };
+static TickLabels_t Ticks_1H = { CHART_1H_INTERVAL, 600, NUM_TICKS_X_1H, -1, {} };
+
+// true when the labels changed
+static bool UpdateTickLabels(TickLabels_t *ticks, time_t now)
+{
+    if (now / (time_t)ticks->interval == ticks->bucket)
+        return false;
+
+    ticks->bucket = now / ticks->interval;
 
-    if (dsc->part == LV_PART_ITEMS)
+    for (uint8_t i = 0; i != ticks->count - 1; i++)
     {
-        if (!dsc->p1 || !dsc->p2)
-            return;
-
-        lv_obj_t *obj = lv_event_get_target(e);
-
-        lv_draw_mask_line_param_t line_mask_param;
-        lv_draw_mask_line_points_init(&line_mask_param, dsc->p1->x, dsc->p1->y, dsc->p2->x, dsc->p2->y, LV_DRAW_MASK_LINE_SIDE_BOTTOM);
-        int16_t line_mask_id = lv_draw_mask_add(&line_mask_param, NULL);
-
-        lv_coord_t h = lv_obj_get_height(obj);
-        lv_draw_mask_fade_param_t fade_mask_param;
-        lv_draw_mask_fade_init(&fade_mask_param, &obj->coords, LV_OPA_COVER, obj->coords.y1 + h / 8, LV_OPA_40, obj->coords.y2);
-        int16_t fade_mask_id = lv_draw_mask_add(&fade_mask_param, NULL);
-
-        lv_draw_rect_dsc_t draw_rect_dsc;
-        lv_draw_rect_dsc_init(&draw_rect_dsc);
-        draw_rect_dsc.bg_opa = LV_OPA_40;
-        draw_rect_dsc.bg_color = dsc->line_dsc->color;
-
-        lv_area_t a;
-        a.x1 = dsc->p1->x;
-        a.x2 = dsc->p2->x - 1;
-        a.y1 = LV_MIN(dsc->p1->y, dsc->p2->y);
-        a.y2 = obj->coords.y2;
-        lv_draw_rect(dsc->draw_ctx, &draw_rect_dsc, &a);
-
-        lv_draw_mask_free_param(&line_mask_param);
-        lv_draw_mask_free_param(&fade_mask_param);
-        lv_draw_mask_remove_id(line_mask_id);
-        lv_draw_mask_remove_id(fade_mask_id);
+        time_t past = now - (time_t)ticks->spacing * (ticks->count - 1 - i);
+        struct tm ltm;
+
+        localtime_r(&past, &ltm);
+        strftime(ticks->text[i], sizeof(ticks->text[i]), "%H:%M", &ltm);
     }
+    snprintf(ticks->text[ticks->count - 1], sizeof(ticks->text[0]), "now");
+
+    return true;
 }
 
-static void draw_event_cb_24H(lv_event_t *e)
+static void DrawTickLabel(lv_event_t *e, TickLabels_t *ticks)
 {
-    static char *hours[NUM_TICKS_X_24H] = { (char *)"00:00", (char *)"00:00", (char *)"00:00", (char *)"00:00", (char *)"00:00", (char *)"00:00", (char *)"00:00", (char *)"00:00",
-        (char *)"00:00", (char *)"00:00", (char *)"00:00", (char *)"now" };
-
     lv_obj_draw_part_dsc_t *dsc = (lv_obj_draw_part_dsc_t *)lv_event_get_param(e);
 
-    if (dsc->part == LV_PART_TICKS && dsc->id == LV_CHART_AXIS_PRIMARY_X)
-    {
-        time_t now = time(NULL);
-        if (dsc->value != NUM_TICKS_X_24H - 1)
-        {
-            time_t past = now - (3600 * (22 - (dsc->value * 2)));
-            struct tm *ltm = localtime(&past);
-            strftime(hours[dsc->value], 6, "%H:%M", ltm);
-        }
-        dsc->text = hours[dsc->value];
-    }
+    if (lv_event_get_code(e) == LV_EVENT_DRAW_PART_BEGIN && dsc->part == LV_PART_TICKS && dsc->id == LV_CHART_AXIS_PRIMARY_X &&
+        dsc->value >= 0 && dsc->value < ticks->count)
+        dsc->text = ticks->text[dsc->value];
+}
 
-    DrawGradient(e);
+static void draw_event_cb_24H(lv_event_t *e)
+{
+    GuiData_t *gd = (GuiData_t *)lv_event_get_user_data(e);
+
+    DrawTickLabel(e, &Ticks_24H);
+    gd->fill_Power_24H->DrawEvent(e);
 }
 
 static void draw_event_cb_1H(lv_event_t *e)
 {
-    static char *hours[NUM_TICKS_X_1H] = { (char *)"00:00", (char *)"00:00", (char *)"00:00", (char *)"00:00", (char *)"00:00", (char *)"now" };
+    GuiData_t *gd = (GuiData_t *)lv_event_get_user_data(e);
 
-    lv_obj_draw_part_dsc_t *dsc = (lv_obj_draw_part_dsc_t *)lv_event_get_param(e);
+    DrawTickLabel(e, &Ticks_1H);
+    gd->fill_Power_1H->DrawEvent(e);
+}
+
+#if CONFIG_SOLAREDGE_LCD_BENCHMARK
+//
+// the benchmark panel: every run of the timer moves a bar and redraws the whole panel right away, not bound by
+// the refresh period. Once a second it shows the frame rate, the flush time and the frame time of the pipeline.
+//
+static void BenchTimer(lv_timer_t *timer)
+{
+    GuiData_t *gd = (GuiData_t *)timer->user_data;
+    static LcdStats_t last;
+    static uint32_t last_tick;
+    LcdStats_t stats;
+    char buf[128];
+
+    lv_obj_set_x(gd->obj_BenchBar, (lv_obj_get_x(gd->obj_BenchBar) + 8) % (800 - 40));
+    lv_obj_invalidate(gd->Panels[PANEL_BENCH]);
+    lv_refr_now(NULL);
 
-    if (dsc->part == LV_PART_TICKS && dsc->id == LV_CHART_AXIS_PRIMARY_X)
+    uint32_t elapsed = lv_tick_elaps(last_tick);
+    if (elapsed < 1000)
+        return;
+
+    LCDGetStats(&stats);
+
+    uint32_t frames = stats.frames - last.frames;
+    if (frames)
     {
-        time_t now = time(NULL);
-        if (dsc->value != NUM_TICKS_X_1H - 1)
-        {
-            time_t past = now - (300 * (10 - dsc->value * 2));
-            struct tm *ltm = localtime(&past);
-            strftime(hours[dsc->value], 6, "%H:%M", ltm);
-        }
-        dsc->text = hours[dsc->value];
+        snprintf(buf, sizeof(buf), "pipeline: " LCD_PIPELINE_NAME "\n%.1f fps\nflush %u us\nframe %u ms", frames * 1000.0 / elapsed,
+                 (unsigned)((stats.flush_us - last.flush_us) / frames), (unsigned)((stats.render_ms - last.render_ms) / frames));
+        LabelSetText(gd->lbl_Bench, buf);
     }
 
-    DrawGradient(e);
+    last = stats;
+    last_tick = lv_tick_get();
+}
+
+static void BenchSetup(GuiData_t *data, lv_obj_t *screen)
+{
+    data->Panels[PANEL_BENCH] = lv_obj_create(screen);
+    lv_obj_set_width(data->Panels[PANEL_BENCH], 800);
+    lv_obj_set_height(data->Panels[PANEL_BENCH], PANEL_HEIGHT);
+    lv_obj_set_align(data->Panels[PANEL_BENCH], LV_ALIGN_TOP_MID);
+    lv_obj_clear_flag(data->Panels[PANEL_BENCH], LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_pos(data->Panels[PANEL_BENCH], 0, PANEL_OFFSET);
+    lv_obj_set_style_bg_color(data->Panels[PANEL_BENCH], lv_color_black(), LV_PART_MAIN);
+    lv_obj_set_style_border_opa(data->Panels[PANEL_BENCH], 0, LV_PART_MAIN);
+    lv_obj_add_flag(data->Panels[PANEL_BENCH], LV_OBJ_FLAG_HIDDEN);
+
+    data->obj_BenchBar = lv_obj_create(data->Panels[PANEL_BENCH]);
+    lv_obj_set_size(data->obj_BenchBar, 40, PANEL_HEIGHT - 40);
+    lv_obj_set_align(data->obj_BenchBar, LV_ALIGN_LEFT_MID);
+    lv_obj_set_style_bg_color(data->obj_BenchBar, lv_palette_main(LV_PALETTE_LIGHT_GREEN), LV_PART_MAIN);
+
+    data->lbl_Bench = lv_label_create(data->Panels[PANEL_BENCH]);
+    lv_obj_set_style_text_font(data->lbl_Bench, &lv_font_montserrat_14, LV_STATE_DEFAULT);
+    lv_obj_set_align(data->lbl_Bench, LV_ALIGN_CENTER);
+    lv_label_set_text(data->lbl_Bench, "pipeline: " LCD_PIPELINE_NAME);
+
+    // only runs while the panel is shown
+    data->tmr_Bench = lv_timer_create(BenchTimer, 1, data);
+    lv_timer_pause(data->tmr_Bench);
 }
+#endif
 
 esp_err_t GUI_Setup(GuiData_t *data)
 {
+    // decoded once from flash, LVGL blits from RAM
+    if (ImageCacheInit() != ESP_OK)
+        ESP_LOGE(TAG, "ImageCacheInit() failed");
+
+    static IntervalAggregator agg_Power_1H(CHART_1H_INTERVAL, &SolarEdge_t::I_AC_Power);
+    static IntervalAggregator agg_Power_24H(CHART_24H_INTERVAL, &SolarEdge_t::I_AC_Power);
+
+    data->agg_Power_1H = &agg_Power_1H;
+    data->agg_Power_24H = &agg_Power_24H;
+
+    static ChartFill fill_Power_1H;
+    static ChartFill fill_Power_24H;
+
+    data->fill_Power_1H = &fill_Power_1H;
+    data->fill_Power_24H = &fill_Power_24H;
+
+    static BigNumber num_I_AC_Power;
+    static BigNumber num_I_AC_Energy_WH_Last24H;
+
+    data->num_I_AC_Power = &num_I_AC_Power;
+    data->num_I_AC_Energy_WH_Last24H = &num_I_AC_Energy_WH_Last24H;
+
+    UpdateTickLabels(&Ticks_1H, time(NULL));
+    UpdateTickLabels(&Ticks_24H, time(NULL));
+
+    data->ActivePanel = PANEL_CHART_1H;
+    data->LatestValid = false;
+    for (uint8_t i = 0; i != PANEL_MAX; i++)
+        data->ChartDirty[i] = false;
+
     lvgl_acquire();
 
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_black(), LV_PART_MAIN);
     lv_obj_add_event_cb(screen, ui_event_Screen, LV_EVENT_ALL, data);
+    LCDSetWakeCallback(ScreenWake, data);
 
     data->Panels[PANEL_CHART_1H] = lv_obj_create(screen);
     data->Panels[PANEL_CHART_24H] = lv_obj_create(screen);
     data->Panels[PANEL_GAUGE] = lv_obj_create(screen);
-    data->Panels[PANEL_MAX] = nullptr;
 
     lv_obj_set_width(data->Panels[PANEL_CHART_1H], 800);
     lv_obj_set_height(data->Panels[PANEL_CHART_1H], PANEL_HEIGHT);
@@ -179,7 +275,7 @@ esp_err_t GUI_Setup(GuiData_t *data)
     lv_obj_set_style_border_opa(data->Panels[PANEL_GAUGE], 0, LV_PART_MAIN);
 
     lv_obj_t *ui_logo_SE = lv_img_create(screen);
-    lv_img_set_src(ui_logo_SE, &se_logo);
+    lv_img_set_src(ui_logo_SE, ImageCacheGet(IMG_SE_LOGO));
     lv_obj_set_align(ui_logo_SE, LV_ALIGN_TOP_MID);
 
     lv_obj_t *ui_Label_Version = lv_label_create(screen);
@@ -192,7 +288,7 @@ esp_err_t GUI_Setup(GuiData_t *data)
 
     data->img_Status = lv_img_create(screen);
     lv_obj_set_align(data->img_Status, LV_ALIGN_TOP_RIGHT);
-    lv_img_set_src(data->img_Status, &se_state_1);
+    lv_img_set_src(data->img_Status, ImageCacheGet(IMG_SE_STATE_1));
 
     data->lbl_C_Model = lv_label_create(screen);
     lv_obj_set_style_text_font(data->lbl_C_Model, &lv_font_montserrat_14, LV_STATE_DEFAULT);
@@ -231,23 +327,18 @@ esp_err_t GUI_Setup(GuiData_t *data)
     lv_obj_set_align(data->lbl_I_AC_Energy_WH, LV_ALIGN_BOTTOM_MID);
     lv_label_set_text(data->lbl_I_AC_Energy_WH, "");
 
-    data->lbl_I_AC_Power = lv_label_create(screen);
-    lv_obj_set_style_text_font(data->lbl_I_AC_Power, &lv_font_montserrat_32, LV_STATE_DEFAULT);
-    lv_obj_set_width(data->lbl_I_AC_Power, LV_SIZE_CONTENT);
-    lv_obj_set_height(data->lbl_I_AC_Power, LV_SIZE_CONTENT);
-    lv_obj_set_align(data->lbl_I_AC_Power, LV_ALIGN_TOP_MID);
-    lv_obj_set_pos(data->lbl_I_AC_Power, -128, 64);
-    lv_obj_set_style_text_color(data->lbl_I_AC_Power, LV_COLOR_MAKE16(0xd2, 0xe3, 0x36), 0);
-    lv_label_set_text(data->lbl_I_AC_Power, "");
-
-    data->lbl_I_AC_Energy_WH_Last24H = lv_label_create(screen);
-    lv_obj_set_style_text_font(data->lbl_I_AC_Energy_WH_Last24H, &lv_font_montserrat_32, LV_STATE_DEFAULT);
-    lv_obj_set_width(data->lbl_I_AC_Energy_WH_Last24H, LV_SIZE_CONTENT);
-    lv_obj_set_height(data->lbl_I_AC_Energy_WH_Last24H, LV_SIZE_CONTENT);
-    lv_obj_set_align(data->lbl_I_AC_Energy_WH_Last24H, LV_ALIGN_TOP_MID);
-    lv_obj_set_pos(data->lbl_I_AC_Energy_WH_Last24H, 128, 64);
-    lv_obj_set_style_text_color(data->lbl_I_AC_Energy_WH_Last24H, LV_COLOR_MAKE16(0xd2, 0xe3, 0x36), 0);
-    lv_label_set_text(data->lbl_I_AC_Energy_WH_Last24H, "");
+    // the big values are blitted from an atlas of their glyphs instead of being rasterised on every change
+    static GlyphAtlas atlas_Big;
+    if (atlas_Big.Init(&lv_font_montserrat_32, LV_COLOR_MAKE16(0xd2, 0xe3, 0x36), "0123456789.- kMGTPW") != ESP_OK)
+        ESP_LOGE(TAG, "GlyphAtlas::Init() failed");
+
+    lv_obj_t *obj = data->num_I_AC_Power->Create(screen, &atlas_Big, BIG_NUMBER_CHARS, BIG_NUMBER_FIXED_WIDTH);
+    lv_obj_set_align(obj, LV_ALIGN_TOP_MID);
+    lv_obj_set_pos(obj, -128, 64);
+
+    obj = data->num_I_AC_Energy_WH_Last24H->Create(screen, &atlas_Big, BIG_NUMBER_CHARS, BIG_NUMBER_FIXED_WIDTH);
+    lv_obj_set_align(obj, LV_ALIGN_TOP_MID);
+    lv_obj_set_pos(obj, 128, 64);
 
     data->lbl_I_AC_Frequency = lv_label_create(screen);
     lv_obj_set_style_text_font(data->lbl_I_AC_Frequency, &lv_font_montserrat_14, LV_STATE_DEFAULT);
@@ -274,13 +365,19 @@ esp_err_t GUI_Setup(GuiData_t *data)
     lv_obj_set_style_line_width(data->chart_Power_1H, 1, LV_PART_ITEMS);
     lv_obj_set_style_size(data->chart_Power_1H, 2, LV_PART_INDICATOR);
 
+#if CHART_MINMAX_BAND
+    data->chart_Series_1H_Max = lv_chart_add_series(data->chart_Power_1H, lv_palette_darken(LV_PALETTE_LIGHT_GREEN, 3), LV_CHART_AXIS_PRIMARY_Y);
+#else
+    data->chart_Series_1H_Max = nullptr;
+#endif
     data->chart_Series_1H = lv_chart_add_series(data->chart_Power_1H, lv_palette_main(LV_PALETTE_LIGHT_GREEN), LV_CHART_AXIS_PRIMARY_Y);
 
     lv_chart_set_range(data->chart_Power_1H, LV_CHART_AXIS_PRIMARY_Y, 0, 6000);
     lv_chart_set_axis_tick(data->chart_Power_1H, LV_CHART_AXIS_PRIMARY_X, 10, 0, NUM_TICKS_X_1H, 1, true, 80);
     lv_chart_set_axis_tick(data->chart_Power_1H, LV_CHART_AXIS_PRIMARY_Y, 5, 0, 5, 1, true, 50);
 
-    lv_obj_add_event_cb(data->chart_Power_1H, draw_event_cb_1H, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    lv_obj_add_event_cb(data->chart_Power_1H, draw_event_cb_1H, LV_EVENT_DRAW_MAIN_BEGIN, data);
+    lv_obj_add_event_cb(data->chart_Power_1H, draw_event_cb_1H, LV_EVENT_DRAW_PART_BEGIN, data);
 
     data->chart_Power_24H = lv_chart_create(data->Panels[PANEL_CHART_24H]);
     lv_obj_set_width(data->chart_Power_24H, CHART_WIDTH);
@@ -293,13 +390,24 @@ esp_err_t GUI_Setup(GuiData_t *data)
     lv_obj_set_style_line_width(data->chart_Power_24H, 1, LV_PART_ITEMS);
     lv_obj_set_style_size(data->chart_Power_24H, 2, LV_PART_INDICATOR);
 
+#if CHART_MINMAX_BAND
+    data->chart_Series_24H_Max = lv_chart_add_series(data->chart_Power_24H, lv_palette_darken(LV_PALETTE_LIGHT_GREEN, 3), LV_CHART_AXIS_PRIMARY_Y);
+#else
+    data->chart_Series_24H_Max = nullptr;
+#endif
     data->chart_Series_24H = lv_chart_add_series(data->chart_Power_24H, lv_palette_main(LV_PALETTE_LIGHT_GREEN), LV_CHART_AXIS_PRIMARY_Y);
 
     lv_chart_set_range(data->chart_Power_24H, LV_CHART_AXIS_PRIMARY_Y, 0, 6000);
     lv_chart_set_axis_tick(data->chart_Power_24H, LV_CHART_AXIS_PRIMARY_X, 10, 0, NUM_TICKS_X_24H, 1, true, 80);
     lv_chart_set_axis_tick(data->chart_Power_24H, LV_CHART_AXIS_PRIMARY_Y, 5, 0, 5, 1, true, 50);
 
-    lv_obj_add_event_cb(data->chart_Power_24H, draw_event_cb_24H, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    lv_obj_add_event_cb(data->chart_Power_24H, draw_event_cb_24H, LV_EVENT_DRAW_MAIN_BEGIN, data);
+    lv_obj_add_event_cb(data->chart_Power_24H, draw_event_cb_24H, LV_EVENT_DRAW_PART_BEGIN, data);
+
+    // the area below the mean, without a PSRAM buffer it is drawn with masks per segment
+    if (data->fill_Power_1H->Init(data->chart_Power_1H, data->chart_Series_1H, 0, 6000, LV_OPA_40) != ESP_OK ||
+        data->fill_Power_24H->Init(data->chart_Power_24H, data->chart_Series_24H, 0, 6000, LV_OPA_40) != ESP_OK)
+        ESP_LOGW(TAG, "chart fill drawn with masks");
 
     data->arc_AmpA = lv_arc_create(data->Panels[PANEL_GAUGE]);
     lv_obj_set_width(data->arc_AmpA, 150);
@@ -398,6 +506,10 @@ esp_err_t GUI_Setup(GuiData_t *data)
     lv_obj_add_flag(data->Panels[PANEL_CHART_24H], LV_OBJ_FLAG_HIDDEN);
     lv_obj_add_flag(data->Panels[PANEL_GAUGE], LV_OBJ_FLAG_HIDDEN);
 
+#if CONFIG_SOLAREDGE_LCD_BENCHMARK
+    BenchSetup(data, screen);
+#endif
+
     lv_disp_load_scr(screen);
 
     lvgl_release();
@@ -405,82 +517,146 @@ esp_err_t GUI_Setup(GuiData_t *data)
     return ESP_OK;
 }
 
-esp_err_t GUI_UpdatePanels(GuiData_t *gd, SolarEdge_t *se)
+//
+// append all buckets closed since the last update to a chart, intervals without data are not drawn.
+// Returns the number of points appended.
+//
+static uint32_t ChartAppendBuckets(IntervalAggregator *agg, lv_obj_t *chart, lv_chart_series_t *series, lv_chart_series_t *series_max, ChartFill *fill)
 {
-    char buf[32];
+    Bucket_t b;
+    uint32_t n = 0;
+
+    while (agg->Pop(&b))
+    {
+        lv_chart_set_next_value(chart, series, b.count ? (lv_coord_t)b.mean : LV_CHART_POINT_NONE);
 
-    SmoothedAverage_24H(se);
-    SmoothedAverage_1H(se);
+        if (series_max)
+            lv_chart_set_next_value(chart, series_max, b.count ? (lv_coord_t)b.max : LV_CHART_POINT_NONE);
 
-    lvgl_acquire();
+        fill->Append();
+        n++;
+    }
+
+    return n;
+}
+
+// the header is always visible
+static void UpdateHeader(GuiData_t *gd, const SolarEdge_t *se)
+{
+    char buf[32];
 
-    lv_label_set_text(gd->lbl_C_Model, (const char *)se->C_Model);
-    lv_label_set_text(gd->lbl_C_Version, (const char *)se->C_Version);
-    lv_label_set_text(gd->lbl_C_SerialNumber, (const char *)se->C_SerialNumber);
+    LabelSetText(gd->lbl_C_Model, (const char *)se->C_Model);
+    LabelSetText(gd->lbl_C_Version, (const char *)se->C_Version);
+    LabelSetText(gd->lbl_C_SerialNumber, (const char *)se->C_SerialNumber);
 
     snprintf(buf, sizeof(buf), "Total: ");
     WattToUnits(buf + strlen(buf), se->I_AC_Energy_WH);
-    lv_label_set_text(gd->lbl_I_AC_Energy_WH, buf);
+    LabelSetText(gd->lbl_I_AC_Energy_WH, buf);
 
-    WattToUnits(buf, (se->I_AC_Energy_WH - se->I_AC_Energy_WH_Last24H));
-    lv_label_set_text(gd->lbl_I_AC_Energy_WH_Last24H, buf);
+    WattToUnits(buf, SE_EnergyToday(se));
+    gd->num_I_AC_Energy_WH_Last24H->SetText(buf);
 
     WattToUnits(buf, se->I_AC_Power);
-    lv_label_set_text(gd->lbl_I_AC_Power, buf);
+    gd->num_I_AC_Power->SetText(buf);
 
     snprintf(buf, sizeof(buf), "Freq: %.2f Hz", se->I_AC_Frequency);
-    lv_label_set_text(gd->lbl_I_AC_Frequency, buf);
+    LabelSetText(gd->lbl_I_AC_Frequency, buf);
 
     snprintf(buf, sizeof(buf), "Temp: %.2f °C", se->I_Temp_Sink);
-    lv_label_set_text(gd->lbl_I_Temp_Sink, buf);
+    LabelSetText(gd->lbl_I_Temp_Sink, buf);
+
+    if (se->I_Status == 5)
+        ImgSetSrc(gd->img_Status, ImageCacheGet(IMG_SE_STATE_5));
+    else if (se->I_Status == 4)
+        ImgSetSrc(gd->img_Status, ImageCacheGet(IMG_SE_STATE_4));
+    else
+        ImgSetSrc(gd->img_Status, ImageCacheGet(IMG_SE_STATE_1));
+}
+
+static void UpdateGauges(GuiData_t *gd, const SolarEdge_t *se)
+{
+    char buf[32];
 
     snprintf(buf, sizeof(buf), "%2.2f Amp", se->I_AC_CurrentA);
-    lv_label_set_text(gd->lbl_I_AC_CurrentA, buf);
+    LabelSetText(gd->lbl_I_AC_CurrentA, buf);
 
     snprintf(buf, sizeof(buf), "%2.2f Amp", se->I_AC_CurrentB);
-    lv_label_set_text(gd->lbl_I_AC_CurrentB, buf);
+    LabelSetText(gd->lbl_I_AC_CurrentB, buf);
 
     snprintf(buf, sizeof(buf), "%2.2f Amp", se->I_AC_CurrentC);
-    lv_label_set_text(gd->lbl_I_AC_CurrentC, buf);
+    LabelSetText(gd->lbl_I_AC_CurrentC, buf);
 
-    lv_arc_set_value(gd->arc_AmpA, se->I_AC_CurrentA);
-    lv_arc_set_value(gd->arc_AmpB, se->I_AC_CurrentB);
-    lv_arc_set_value(gd->arc_AmpC, se->I_AC_CurrentC);
+    ArcSetValue(gd->arc_AmpA, se->I_AC_CurrentA);
+    ArcSetValue(gd->arc_AmpB, se->I_AC_CurrentB);
+    ArcSetValue(gd->arc_AmpC, se->I_AC_CurrentC);
 
     snprintf(buf, sizeof(buf), "%3.2f Volt", se->I_AC_VoltageAN);
-    lv_label_set_text(gd->lbl_I_AC_VoltageAN, buf);
+    LabelSetText(gd->lbl_I_AC_VoltageAN, buf);
 
     snprintf(buf, sizeof(buf), "%3.2f Volt", se->I_AC_VoltageBN);
-    lv_label_set_text(gd->lbl_I_AC_VoltageBN, buf);
+    LabelSetText(gd->lbl_I_AC_VoltageBN, buf);
 
     snprintf(buf, sizeof(buf), "%3.2f Volt", se->I_AC_VoltageCN);
-    lv_label_set_text(gd->lbl_I_AC_VoltageCN, buf);
+    LabelSetText(gd->lbl_I_AC_VoltageCN, buf);
 
-    lv_arc_set_value(gd->arc_VoltAN, se->I_AC_VoltageAN);
-    lv_arc_set_value(gd->arc_VoltBN, se->I_AC_VoltageBN);
-    lv_arc_set_value(gd->arc_VoltCN, se->I_AC_VoltageCN);
+    ArcSetValue(gd->arc_VoltAN, se->I_AC_VoltageAN);
+    ArcSetValue(gd->arc_VoltBN, se->I_AC_VoltageBN);
+    ArcSetValue(gd->arc_VoltCN, se->I_AC_VoltageCN);
+}
 
-    if (se->I_Status == 5)
-        lv_img_set_src(gd->img_Status, &se_state_5);
-    else if (se->I_Status == 4)
-        lv_img_set_src(gd->img_Status, &se_state_4);
-    else
-        lv_img_set_src(gd->img_Status, &se_state_1);
+static lv_obj_t *PanelChart(GuiData_t *gd, uint8_t panel)
+{
+    if (panel == PANEL_CHART_1H)
+        return gd->chart_Power_1H;
+    if (panel == PANEL_CHART_24H)
+        return gd->chart_Power_24H;
 
-    if (se->UpdatePower_24H)
-    {
-        lv_chart_set_next_value(gd->chart_Power_24H, gd->chart_Series_24H, se->AVG_Power_24H);
-        se->UpdatePower_24H = false;
-    }
+    return nullptr;
+}
+
+//
+// bring the visible panel up to date. Hidden panels only keep their model: the last sample,
+// and the points appended to the series of a chart
+//
+static void SyncPanel(GuiData_t *gd, uint8_t panel)
+{
+    lv_obj_t *chart = PanelChart(gd, panel);
 
-    if (se->UpdatePower_1H)
+    if (chart && gd->ChartDirty[panel])
     {
-        lv_chart_set_next_value(gd->chart_Power_1H, gd->chart_Series_1H, se->AVG_Power_1H);
-        se->UpdatePower_1H = false;
+        lv_chart_refresh(chart);
+        gd->ChartDirty[panel] = false;
     }
 
-    lv_chart_refresh(gd->chart_Power_24H);
-    lv_chart_refresh(gd->chart_Power_1H);
+    if (panel == PANEL_GAUGE && gd->LatestValid)
+        UpdateGauges(gd, &gd->Latest);
+}
+
+esp_err_t GUI_UpdatePanels(GuiData_t *gd, SolarEdge_t *se)
+{
+    lvgl_acquire();
+
+    gd->Latest = *se;
+    gd->LatestValid = true;
+
+    UpdateHeader(gd, se);
+
+    // a chart only changes when a bucket closed: every 10 seconds or 6 minutes
+    if (ChartAppendBuckets(gd->agg_Power_24H, gd->chart_Power_24H, gd->chart_Series_24H, gd->chart_Series_24H_Max, gd->fill_Power_24H))
+        gd->ChartDirty[PANEL_CHART_24H] = true;
+
+    if (ChartAppendBuckets(gd->agg_Power_1H, gd->chart_Power_1H, gd->chart_Series_1H, gd->chart_Series_1H_Max, gd->fill_Power_1H))
+        gd->ChartDirty[PANEL_CHART_1H] = true;
+
+    time_t now = time(NULL);
+
+    if (UpdateTickLabels(&Ticks_24H, now))
+        gd->ChartDirty[PANEL_CHART_24H] = true;
+
+    if (UpdateTickLabels(&Ticks_1H, now))
+        gd->ChartDirty[PANEL_CHART_1H] = true;
+
+    SyncPanel(gd, gd->ActivePanel);
 
     lvgl_release();
 
@@ -489,25 +665,33 @@ esp_err_t GUI_UpdatePanels(GuiData_t *gd, SolarEdge_t *se)
 
 esp_err_t GUI_TogglePanel(GuiData_t *gd)
 {
-    static uint8_t toggle;
+    lvgl_acquire();
 
-    toggle++;
-    if (toggle >= PANEL_MAX)
-        toggle = 0;
+    gd->ActivePanel++;
+    if (gd->ActivePanel >= PANEL_MAX)
+        gd->ActivePanel = 0;
 
-    lvgl_acquire();
+    // update the panel before it is shown, it is rendered once
+    SyncPanel(gd, gd->ActivePanel);
 
     for (uint8_t i = 0; i != PANEL_MAX; i++)
     {
         if (gd->Panels[i])
         {
-            if (i != toggle)
+            if (i != gd->ActivePanel)
                 lv_obj_add_flag(gd->Panels[i], LV_OBJ_FLAG_HIDDEN);
             else
                 lv_obj_clear_flag(gd->Panels[i], LV_OBJ_FLAG_HIDDEN);
         }
     }
 
+#if CONFIG_SOLAREDGE_LCD_BENCHMARK
+    if (gd->ActivePanel == PANEL_BENCH)
+        lv_timer_resume(gd->tmr_Bench);
+    else
+        lv_timer_pause(gd->tmr_Bench);
+#endif
+
     lvgl_release();
 
     return ESP_OK;
@@ -554,37 +738,3 @@ esp_err_t GUI_SetStatus(GuiData_t *gd, TGuiState s)
 
     return ESP_OK;
 }
-
-void SmoothedAverage_24H(SolarEdge_t *sf)
-{
-    static Smooth avg(NUM_MEASUREMENTS);
-    static time_t lastTime = 0;
-
-    avg += sf->I_AC_Power;
-    if (lastTime < time(NULL))
-    {
-        if (sf->UpdatePower_24H == false)
-        {
-            lastTime = time(NULL) + 360;
-            sf->AVG_Power_24H = avg();
-            sf->UpdatePower_24H = true;
-        }
-    }
-}
-
-void SmoothedAverage_1H(SolarEdge_t *sf)
-{
-    static Smooth avg(NUM_MEASUREMENTS);
-    static time_t lastTime = 0;
-
-    avg += sf->I_AC_Power;
-    if (lastTime < time(NULL))
-    {
-        if (sf->UpdatePower_1H == false)
-        {
-            lastTime = time(NULL) + 10;
-            sf->AVG_Power_1H = avg();
-            sf->UpdatePower_1H = true;
-        }
-    }
-}
@@ -1,16 +1,39 @@
 #pragma once
 
+#include <sdkconfig.h>
 #include <esp_err.h>
 
 #include <lvgl.h>
 
 #include "sunspec.h"
-
-enum { PANEL_CHART_1H = 0, PANEL_CHART_24H, PANEL_GAUGE, PANEL_MAX };
+#include "Aggregator.h"
+#include "ChartFill.h"
+#include "BigNumber.h"
+
+enum {
+    PANEL_CHART_1H = 0,
+    PANEL_CHART_24H,
+    PANEL_GAUGE,
+#if CONFIG_SOLAREDGE_LCD_BENCHMARK
+    PANEL_BENCH,
+#endif
+    PANEL_MAX
+};
 
 #define CHART_24H_NUM_POINTS 240
 #define CHART_1H_NUM_POINTS  360
 
+// seconds between two points on the charts, every point is the exact mean of its interval
+#define CHART_24H_INTERVAL 360
+#define CHART_1H_INTERVAL  10
+
+// draw the maximum of every interval as a second, dimmed line on the charts
+#define CHART_MINMAX_BAND 1
+
+// the digits of the big values take the same width, the value does not jitter when it changes
+#define BIG_NUMBER_FIXED_WIDTH 1
+#define BIG_NUMBER_CHARS       9 // "999.99 kW"
+
 typedef struct
 {
     lv_obj_t *Panels[PANEL_MAX];
@@ -23,16 +46,22 @@ typedef struct
     lv_obj_t *lbl_C_SerialNumber;
 
     lv_obj_t *lbl_I_AC_Energy_WH;
-    lv_obj_t *lbl_I_AC_Energy_WH_Last24H;
-    lv_obj_t *lbl_I_AC_Power;
+    BigNumber *num_I_AC_Energy_WH_Last24H;
+    BigNumber *num_I_AC_Power;
     lv_obj_t *lbl_I_AC_Frequency;
     lv_obj_t *lbl_I_Temp_Sink;
 
     lv_obj_t *chart_Power_24H;
     lv_chart_series_t *chart_Series_24H;
+    lv_chart_series_t *chart_Series_24H_Max;
+    IntervalAggregator *agg_Power_24H;
+    ChartFill *fill_Power_24H;
 
     lv_obj_t *chart_Power_1H;
     lv_chart_series_t *chart_Series_1H;
+    lv_chart_series_t *chart_Series_1H_Max;
+    IntervalAggregator *agg_Power_1H;
+    ChartFill *fill_Power_1H;
 
     lv_obj_t *lbl_I_AC_CurrentA;
     lv_obj_t *lbl_I_AC_CurrentB;
@@ -50,6 +79,17 @@ typedef struct
     lv_obj_t *arc_VoltBN;
     lv_obj_t *arc_VoltCN;
 
+#if CONFIG_SOLAREDGE_LCD_BENCHMARK
+    lv_obj_t *lbl_Bench;
+    lv_obj_t *obj_BenchBar;
+    lv_timer_t *tmr_Bench;
+#endif
+
+    uint8_t ActivePanel;
+    bool ChartDirty[PANEL_MAX]; // points were appended while the chart was hidden
+    bool LatestValid;
+    SolarEdge_t Latest; // the last sample, to bring a panel up to date when it is shown
+
     SemaphoreHandle_t BackLightChange;
     uint8_t BackLightActive;
     bool *ntp_synced;
@@ -64,7 +104,3 @@ esp_err_t GUI_UpdatePanels(GuiData_t *, SolarEdge_t *);
 esp_err_t GUI_SetStatus(GuiData_t *, TGuiState s);
 
 esp_err_t GUI_TogglePanel(GuiData_t *gd);
-
-void SmoothedAverage_24H(SolarEdge_t *sf);
-
-void SmoothedAverage_1H(SolarEdge_t *sf);
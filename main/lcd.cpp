@@ -1,9 +1,12 @@
+#include <string.h>
+
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/semphr.h>
 
 #include <esp_log.h>
 #include <esp_err.h>
+#include <esp_timer.h>
 
 #include <esp_lcd_panel_ops.h>
 #include <esp_lcd_panel_rgb.h>
@@ -23,19 +26,89 @@ const i2c_port_t i2c_master_port = I2C_NUM_0;
 
 static SemaphoreHandle_t xGuiSemaphore = NULL;
 static TaskHandle_t g_lvgl_task_handle;
+static LcdStats_t g_lcd_stats;
+static lv_indev_t *g_touch_indev;
+static esp_lcd_touch_handle_t g_touch;
+static volatile bool g_lcd_active = true;
+static volatile bool g_touch_pending; // the GT911 has a new report
+static void (*g_wake_cb)(void *ctx);
+static void *g_wake_ctx;
+#if CONFIG_SOLAREDGE_LCD_PIPELINE_DIRECT
+static SemaphoreHandle_t g_vsync;
+#endif
+
+#if CONFIG_SOLAREDGE_LCD_PIPELINE_PSRAM
+#define LCD_BOUNCE_PX 0
+#else
+#define LCD_BOUNCE_PX (LCD_H_RES * CONFIG_SOLAREDGE_LCD_BOUNCE_LINES)
+
+// esp_lcd_new_rgb_panel() wants the frame to be an even number of bounce buffers, the last one ends in the second buffer
+static_assert(LCD_V_RES % (2 * CONFIG_SOLAREDGE_LCD_BOUNCE_LINES) == 0, "LCD_V_RES must be an even multiple of CONFIG_SOLAREDGE_LCD_BOUNCE_LINES");
+#endif
+
+#if CONFIG_SOLAREDGE_LCD_PIPELINE_DIRECT
+static bool IRAM_ATTR lcd_on_vsync(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx)
+{
+    BaseType_t woken = pdFALSE;
+
+    xSemaphoreGiveFromISR(g_vsync, &woken);
+
+    return woken == pdTRUE;
+}
+
+// copy the areas drawn in this frame into the other framebuffer, LVGL draws the next frame into it
+static void SyncFramebuffers(lv_disp_drv_t *drv, const lv_color_t *shown)
+{
+    lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+    lv_color_t *other = (lv_color_t *)((shown == drv->draw_buf->buf1) ? drv->draw_buf->buf2 : drv->draw_buf->buf1);
+
+    for (uint16_t i = 0; i != disp->inv_p; i++)
+    {
+        if (disp->inv_area_joined[i])
+            continue;
+
+        const lv_area_t *a = &disp->inv_areas[i];
+        size_t len = lv_area_get_width(a) * sizeof(lv_color_t);
+
+        for (lv_coord_t y = a->y1; y <= a->y2; y++)
+            memcpy(other + y * LCD_H_RES + a->x1, shown + y * LCD_H_RES + a->x1, len);
+    }
+}
+#endif
 
 static void lcd_lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
     auto panel_handle = (esp_lcd_panel_handle_t)drv->user_data;
-    int offsetx1 = area->x1;
-    int offsetx2 = area->x2;
-    int offsety1 = area->y1;
-    int offsety2 = area->y2;
+    int64_t start = esp_timer_get_time();
+
+#if CONFIG_SOLAREDGE_LCD_PIPELINE_DIRECT
+    // color_map is a framebuffer of the panel, drawing it only makes it the next one shown. Once the vsync
+    // passed the other framebuffer is no longer read and LVGL may draw into it
+    if (lv_disp_flush_is_last(drv))
+    {
+        xSemaphoreTake(g_vsync, 0);
+        esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, LCD_H_RES, LCD_V_RES, color_map);
+        xSemaphoreTake(g_vsync, portMAX_DELAY);
+
+        SyncFramebuffers(drv, color_map);
+    }
+#else
+    esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1, area->x2 + 1, area->y2 + 1, color_map);
+#endif
 
-    esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
+    g_lcd_stats.flush_us += esp_timer_get_time() - start;
     lv_disp_flush_ready(drv);
 }
 
+// called by LVGL after every refresh, in the lvgl task
+static void lcd_lvgl_monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px)
+{
+    if (g_lcd_stats.frames++ == 0)
+        g_lcd_stats.first_frame_ms = esp_timer_get_time() / 1000;
+    g_lcd_stats.render_ms += time;
+    g_lcd_stats.pixels += px;
+}
+
 esp_err_t InitI2C(void)
 {
     i2c_config_t conf = { .mode = I2C_MODE_MASTER,
@@ -64,6 +137,19 @@ void process_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, ui
     *y = map(*y, TOUCH_V_RES_MIN, TOUCH_V_RES_MAX, 0, LCD_V_RES);
 }
 
+// GT911 INT: a new report while the screen is touched, and a last one after the release
+static void IRAM_ATTR gt911_touch_isr(esp_lcd_touch_handle_t tp)
+{
+    BaseType_t woken = pdFALSE;
+
+    g_touch_pending = true;
+
+    if (g_lvgl_task_handle)
+        vTaskNotifyGiveFromISR(g_lvgl_task_handle, &woken);
+
+    portYIELD_FROM_ISR(woken);
+}
+
 void gt911_touch_init(esp_lcd_touch_handle_t *tp)
 {
     esp_lcd_panel_io_handle_t tp_io_handle = nullptr;
@@ -95,26 +181,45 @@ void gt911_touch_init(esp_lcd_touch_handle_t *tp)
             .mirror_y = 0,
         },
         .process_coordinates = process_coordinates,
-        .interrupt_callback = nullptr
+        .interrupt_callback = gt911_touch_isr
         };
 
     ESP_ERROR_CHECK(esp_lcd_new_panel_io_i2c((esp_lcd_i2c_bus_handle_t)i2c_master_port, &tp_io_config, &tp_io_handle));
     ESP_ERROR_CHECK(esp_lcd_touch_new_i2c_gt911(tp_io_handle, &tp_cfg, tp));
 }
 
+//
+// the controller is only read after an interrupt, and while the screen is touched. Without a report and
+// nothing left to scroll the read timer is paused, the lvgl task resumes it on the next interrupt.
+//
 static void gt911_touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
 {
+    static bool pressed = false;
+
     auto tp = (esp_lcd_touch_handle_t)indev_drv->user_data;
     assert(tp);
 
+    if (!pressed && !g_touch_pending)
+    {
+        data->state = LV_INDEV_STATE_RELEASED;
+
+        if (g_touch_indev && !lv_indev_get_scroll_obj(g_touch_indev))
+            lv_timer_pause(indev_drv->read_timer);
+        return;
+    }
+
+    g_touch_pending = false;
+
     uint16_t touchpad_x;
     uint16_t touchpad_y;
     uint8_t touchpad_cnt = 0;
 
     esp_lcd_touch_read_data(tp);
+    g_lcd_stats.touch_reads++;
 
     bool touchpad_pressed = esp_lcd_touch_get_coordinates(tp, &touchpad_x, &touchpad_y, nullptr, &touchpad_cnt, 1);
-    if (touchpad_pressed && touchpad_cnt > 0)
+    pressed = touchpad_pressed && touchpad_cnt > 0;
+    if (pressed)
     {
         data->point.x = touchpad_x;
         data->point.y = touchpad_y;
@@ -141,22 +246,131 @@ void lvgl_release(void)
     if (g_lvgl_task_handle != task)
     {
         xSemaphoreGive(xGuiSemaphore);
+
+        if (g_lvgl_task_handle)
+            xTaskNotifyGive(g_lvgl_task_handle);
+    }
+}
+
+void LCDGetStats(LcdStats_t *stats)
+{
+    // not lvgl_acquire(), reading the statistics does not wake the lvgl task
+    if (g_lvgl_task_handle == xTaskGetCurrentTaskHandle())
+        *stats = g_lcd_stats;
+    else
+    {
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+        *stats = g_lcd_stats;
+        xSemaphoreGive(xGuiSemaphore);
     }
 }
 
+void LCDSetActive(bool active)
+{
+    g_lcd_active = active;
+
+    if (g_lvgl_task_handle)
+        xTaskNotifyGive(g_lvgl_task_handle);
+}
+
+void LCDSetWakeCallback(void (*cb)(void *ctx), void *ctx)
+{
+    g_wake_ctx = ctx;
+    g_wake_cb = cb;
+}
+
+static bool TouchPressed(void)
+{
+    uint16_t x, y;
+    uint8_t cnt = 0;
+
+    g_touch_pending = false;
+
+    esp_lcd_touch_read_data(g_touch);
+    g_lcd_stats.touch_reads++;
+
+    return esp_lcd_touch_get_coordinates(g_touch, &x, &y, nullptr, &cnt, 1) && cnt > 0;
+}
+
+//
+// LVGL only runs when a timer is due (the display refresh is paused while nothing is invalidated, the
+// animations while none runs, the touch read while nobody touches the screen) or when it is notified:
+// lvgl_release() after a change, LCDSetActive(), the touch interrupt.
+// With the backlight off LVGL does not run, a touch interrupt turns the screen on.
+//
 void lvUpdateTask(void *ptr)
 {
+    TickType_t wait = 0;
+
     while (true)
     {
-        vTaskDelay(pdMS_TO_TICKS(20));
+        int64_t idle_start = esp_timer_get_time();
+
+        ulTaskNotifyTake(pdTRUE, wait);
+
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+
+        int64_t start = esp_timer_get_time();
+        g_lcd_stats.idle_us += start - idle_start;
 
-        if (pdTRUE == xSemaphoreTake(xGuiSemaphore, portMAX_DELAY))
+        if (g_lcd_active)
         {
-            lv_task_handler();
-            xSemaphoreGive(xGuiSemaphore);
+            // read the new report now, not after the read period
+            if (g_touch_pending)
+            {
+                lv_timer_resume(g_touch_indev->driver->read_timer);
+                lv_timer_ready(g_touch_indev->driver->read_timer);
+            }
+
+            uint32_t next = lv_timer_handler();
+
+            wait = pdMS_TO_TICKS((next < LCD_MAX_SLEEP_MS) ? next : LCD_MAX_SLEEP_MS);
+            if (wait == 0)
+                wait = 1;
         }
+        else
+        {
+            wait = portMAX_DELAY;
+
+            if (g_touch_pending && TouchPressed())
+            {
+                g_lcd_active = true;
+                wait = 0;
+
+                // the touch only turns the screen on, it is no click
+                lv_indev_wait_release(g_touch_indev);
+
+                if (g_wake_cb)
+                    g_wake_cb(g_wake_ctx);
+            }
+        }
+
+        g_lcd_stats.busy_us += esp_timer_get_time() - start;
+
+        xSemaphoreGive(xGuiSemaphore);
+    }
+}
+
+#if !CONFIG_SOLAREDGE_LCD_PIPELINE_DIRECT
+// two draw buffers of lines each, false when there is not enough memory
+static bool AllocDrawBuffers(lv_disp_draw_buf_t *disp_buf, size_t lines, uint32_t caps)
+{
+    size_t size = LCD_H_RES * lines * sizeof(lv_color_t);
+    void *buf1 = heap_caps_malloc(size, caps);
+    void *buf2 = heap_caps_malloc(size, caps);
+
+    if (!buf1 || !buf2)
+    {
+        heap_caps_free(buf1);
+        heap_caps_free(buf2);
+        return false;
     }
+
+    lv_disp_draw_buf_init(disp_buf, buf1, buf2, LCD_H_RES * lines);
+
+    return true;
 }
+#endif
 
 esp_err_t LCDInit(void)
 {
@@ -181,7 +395,7 @@ esp_err_t LCDInit(void)
         .data_width = 16,
         .bits_per_pixel = 0,
         .num_fbs = 2,
-        .bounce_buffer_size_px = 0,
+        .bounce_buffer_size_px = LCD_BOUNCE_PX,
         .sram_trans_align = 0,
         .psram_trans_align = 64,
 
@@ -204,20 +418,45 @@ esp_err_t LCDInit(void)
     ESP_LOGI(TAG, "Initialize LVGL library");
     lv_init();
 
-    ESP_LOGI(TAG, "Allocate separate LVGL draw buffers from PSRAM");
-    void *buf1 = heap_caps_malloc(LCD_H_RES * 100 * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
-    assert(buf1);
-    void *buf2 = heap_caps_malloc(LCD_H_RES * 100 * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
-    assert(buf2);
+#if CONFIG_SOLAREDGE_LCD_PIPELINE_DIRECT
+    ESP_LOGI(TAG, "LVGL draws into the framebuffers of the panel");
+    void *fb1, *fb2;
+    ESP_ERROR_CHECK(esp_lcd_rgb_panel_get_frame_buffer(panel_handle, 2, &fb1, &fb2));
+    lv_disp_draw_buf_init(&disp_buf, fb1, fb2, LCD_H_RES * LCD_V_RES);
+
+    g_vsync = xSemaphoreCreateBinary();
+
+    esp_lcd_rgb_panel_event_callbacks_t cbs = {};
+    cbs.on_vsync = lcd_on_vsync;
+    ESP_ERROR_CHECK(esp_lcd_rgb_panel_register_event_callbacks(panel_handle, &cbs, nullptr));
+#else
+    bool allocated = false;
 
-    lv_disp_draw_buf_init(&disp_buf, buf1, buf2, LCD_H_RES * 100);
+#if CONFIG_SOLAREDGE_LCD_PIPELINE_BOUNCE
+    if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL) >= 2 * LCD_H_RES * CONFIG_SOLAREDGE_LCD_DRAW_LINES * sizeof(lv_color_t) + LCD_INTERNAL_RESERVE)
+        allocated = AllocDrawBuffers(&disp_buf, CONFIG_SOLAREDGE_LCD_DRAW_LINES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#endif
+
+    if (allocated)
+        ESP_LOGI(TAG, "Allocate LVGL draw buffers from internal RAM");
+    else
+    {
+        ESP_LOGI(TAG, "Allocate separate LVGL draw buffers from PSRAM");
+        allocated = AllocDrawBuffers(&disp_buf, LCD_PSRAM_DRAW_LINES, MALLOC_CAP_SPIRAM);
+        assert(allocated);
+    }
+#endif
 
     ESP_LOGI(TAG, "Register display driver to LVGL");
     lv_disp_drv_init(&disp_drv);
     disp_drv.hor_res = LCD_H_RES;
     disp_drv.ver_res = LCD_V_RES;
     disp_drv.flush_cb = lcd_lvgl_flush_cb;
+    disp_drv.monitor_cb = lcd_lvgl_monitor_cb;
     disp_drv.draw_buf = &disp_buf;
+#if CONFIG_SOLAREDGE_LCD_PIPELINE_DIRECT
+    disp_drv.direct_mode = true;
+#endif
     disp_drv.user_data = panel_handle;
 
     lv_disp_drv_register(&disp_drv);
@@ -232,9 +471,13 @@ esp_err_t LCDInit(void)
 
     xGuiSemaphore = xSemaphoreCreateMutex();
 
-    if (lv_indev_drv_register(&indev_drv_tp))
+    g_touch = tp;
+    g_touch_indev = lv_indev_drv_register(&indev_drv_tp);
+
+    if (g_touch_indev)
     {
-        xTaskCreatePinnedToCore(&lvUpdateTask, "lv_update", 8192, nullptr, tskIDLE_PRIORITY, &g_lvgl_task_handle, 1);
+        // above the idle task of core 1, it no longer shares time slices with it: the idle time is real
+        xTaskCreatePinnedToCore(&lvUpdateTask, "lv_update", 8192, nullptr, tskIDLE_PRIORITY + 1, &g_lvgl_task_handle, 1);
 
         return ESP_OK;
     }
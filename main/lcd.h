@@ -1,5 +1,6 @@
 #pragma once
 
+#include <sdkconfig.h>
 #include <esp_err.h>
 
 //
@@ -52,6 +53,42 @@
 #define TOUCH_PIN_INT   (gpio_num_t) GPIO_NUM_18
 #define TOUCH_FREQ_HZ   (400000)
 
+#if CONFIG_SOLAREDGE_LCD_PIPELINE_DIRECT
+#define LCD_PIPELINE_NAME "direct"
+#elif CONFIG_SOLAREDGE_LCD_PIPELINE_BOUNCE
+#define LCD_PIPELINE_NAME "bounce"
+#else
+#define LCD_PIPELINE_NAME "psram"
+#endif
+
+#define LCD_PSRAM_DRAW_LINES 100
+// internal RAM left for WiFi and the rest, before draw buffers are taken from it
+#define LCD_INTERNAL_RESERVE (96 * 1024)
+
+// longest sleep of the lvgl task without a pending timer, notifications wake it earlier
+#define LCD_MAX_SLEEP_MS 500
+
+typedef struct
+{
+    uint32_t frames;         // refreshes of the display
+    uint32_t render_ms;      // time spent rendering and flushing
+    uint64_t flush_us;       // time spent flushing: copying into the framebuffer or waiting for the vsync
+    uint64_t pixels;         // pixels rendered, the invalidated area
+    uint64_t busy_us;        // time the lvgl task was running
+    uint64_t idle_us;        // time the lvgl task was waiting for the next timer or a notification
+    uint32_t touch_reads;    // reads of the touch controller, only after an interrupt or while touched
+    uint32_t first_frame_ms; // time from boot to the first frame on the display
+} LcdStats_t;
+
 esp_err_t LCDInit(void);
+void LCDGetStats(LcdStats_t *stats);
+
+// false: the backlight is off, LVGL is not processed at all until LCDSetActive(true) or a touch.
+// A dimmed screen is still readable and stays active
+void LCDSetActive(bool active);
+// called from the lvgl task when a touch turns the screen on again, the touch itself is not passed to LVGL
+void LCDSetWakeCallback(void (*cb)(void *ctx), void *ctx);
+
+// lvgl_release() wakes the lvgl task, what was changed is rendered right away
 void lvgl_acquire(void);
 void lvgl_release(void);
@@ -5,10 +5,12 @@
 #include <freertos/task.h>
 #include <freertos/semphr.h>
 #include <freertos/event_groups.h>
+#include <freertos/queue.h>
 
 #include <esp_log.h>
 #include <esp_system.h>
 #include <esp_err.h>
+#include <esp_timer.h>
 #include <esp_netif.h>
 #include <mqtt_client.h>
 #include <esp_sntp.h>
@@ -30,10 +32,31 @@
 #include "TaskModbus.h"
 #include "Configuration.h"
 #include "solaredge_mqtt.h"
+#include "Statistics.h"
+#include "Alerts.h"
+#include "Deadband.h"
+#include "Commands.h"
+#include "HttpServer.h"
+#include "Metrics.h"
+#include "Influx.h"
+#include "WsStream.h"
+#include "History.h"
+#include "Dashboard.h"
 #include "private_types.h"
 
 #define TAG _PROJECT_NAME_
 
+// channels with daily percentiles published on <topic>/stats
+static const SEChannel_t StatsChannels[] = { CH_I_AC_Power, CH_I_Temp_Sink, CH_I_AC_VoltageAN, CH_I_AC_VoltageBN, CH_I_AC_VoltageCN };
+
+// channels kept on the device for the web dashboard, with the resolution they are stored in
+static const HistoryChannel_t HistoryChannels[] = {
+    { CH_I_AC_Power, 1.0f },
+    { CH_I_DC_Power, 1.0f },
+    { CH_I_Temp_Sink, 0.01f },
+    { CH_I_AC_VoltageAN, 0.1f },
+};
+
 bool NTPTimeSynced = false;
 static WifiUser_t wifiUser;
 
@@ -57,6 +80,127 @@ static void time_sync_notification_cb(struct timeval *tv)
     NTPTimeSynced = true;
 }
 
+//
+// apply a command from <topic>/cmd, called by the main loop between two samples.
+// On success 'detail' holds an optional json result, on failure the error message.
+//
+static esp_err_t ApplyCommand(
+    const Command_t *cmd, TaskModbus_t *data, MQTT_user_t *mqtt_user, uint16_t *mqtt_freq, Configuration *config, char *detail, size_t size)
+{
+    char key[48], buf[48];
+    uint32_t formats;
+    SEChannel_t ch;
+
+    detail[0] = '\0';
+
+    switch (cmd->Type)
+    {
+        case CMD_POLL:
+            if (cmd->Value < COMMAND_POLL_MIN || cmd->Value > COMMAND_POLL_MAX)
+            {
+                snprintf(detail, size, "poll must be %d..%d ms", COMMAND_POLL_MIN, COMMAND_POLL_MAX);
+                return ESP_ERR_INVALID_ARG;
+            }
+
+            data->query_delay = cmd->Value;
+            break;
+
+        case CMD_FREQUENCY:
+            if (cmd->Value < 0 || cmd->Value > COMMAND_FREQUENCY_MAX)
+            {
+                snprintf(detail, size, "frequency must be 0..%d s", COMMAND_FREQUENCY_MAX);
+                return ESP_ERR_INVALID_ARG;
+            }
+
+            *mqtt_freq = cmd->Value;
+            break;
+
+        case CMD_FORMAT:
+            formats = MQTT_ParseFormats(cmd->Arg);
+            if (!formats)
+            {
+                snprintf(detail, size, "formats must be a list of json, cbor, fields, batch");
+                return ESP_ERR_INVALID_ARG;
+            }
+
+            // newly enabled sinks start with a complete state
+            if ((formats & MQTT_FORMAT_JSON) && !(mqtt_user->formats & MQTT_FORMAT_JSON))
+                mqtt_user->discovery_pending = true;
+            if ((formats & MQTT_FORMAT_FIELDS) && !(mqtt_user->formats & MQTT_FORMAT_FIELDS))
+                mqtt_user->fields_stale = true;
+            if ((formats & MQTT_FORMAT_CBOR) && !(mqtt_user->formats & MQTT_FORMAT_CBOR))
+                mqtt_user->schema_pending = true;
+
+            mqtt_user->formats = formats;
+            break;
+
+        case CMD_DEADBAND:
+            ch = SE_ChannelByName(cmd->Arg);
+            if (ch == CH_MAX || cmd->Deadband.Absolute < 0 || cmd->Deadband.Relative < 0 || cmd->Deadband.MaxAge == 0)
+            {
+                snprintf(detail, size, "invalid channel or deadband");
+                return ESP_ERR_INVALID_ARG;
+            }
+
+            mqtt_user->deadband->Configure(ch, &cmd->Deadband);
+            break;
+
+        case CMD_BURST:
+            if (cmd->Value < 0 || cmd->Value > COMMAND_BURST_MAX)
+            {
+                snprintf(detail, size, "burst must be 0..%d s", COMMAND_BURST_MAX);
+                return ESP_ERR_INVALID_ARG;
+            }
+
+            data->burst_end = (uint32_t)(esp_timer_get_time() / 1000000LL) + cmd->Value;
+            break;
+
+        case CMD_STATS:
+            MQTT_FormatsString(mqtt_user->formats, buf, sizeof(buf));
+            snprintf(detail, size,
+                "{\"poll\":%" PRIu32 ",\"frequency\":%u,\"formats\":\"%s\",\"json_bytes\":%u,\"json_us\":%lld,\"cbor_bytes\":%u,\"cbor_us\":%lld"
+                ",\"batch_bytes\":%u,\"batch_dropped\":%" PRIu32 ",\"heap\":%" PRIu32 ",\"heap_min\":%" PRIu32 ",\"uptime\":%lld}",
+                data->query_delay, *mqtt_freq, buf, (unsigned)mqtt_user->stats.json_bytes, (long long)mqtt_user->stats.json_us,
+                (unsigned)mqtt_user->stats.cbor_bytes, (long long)mqtt_user->stats.cbor_us, (unsigned)mqtt_user->stats.batch_bytes,
+                mqtt_user->stats.batch_dropped, esp_get_free_heap_size(), esp_get_minimum_free_heap_size(), (long long)(esp_timer_get_time() / 1000000LL));
+            break;
+
+        case CMD_SAVE:
+            snprintf(buf, sizeof(buf), "%" PRIu32, data->query_delay);
+            config->Set(JS_MBDELAY, buf);
+            snprintf(buf, sizeof(buf), "%u", *mqtt_freq);
+            config->Set(JS_MQTT_FREQ, buf);
+            MQTT_FormatsString(mqtt_user->formats, buf, sizeof(buf));
+            config->Set(JS_MQTT_FORMAT, buf);
+
+            for (int i = 0; i != CH_MAX; i++)
+            {
+                const DeadbandCfg_t *cfg = mqtt_user->deadband->GetConfig((SEChannel_t)i);
+
+                snprintf(key, sizeof(key), JS_DEADBAND_PREFIX "%s", SE_Channels[i].Name);
+
+                if (config->Get(key) || cfg->Absolute != DeadbandDefaults[i].Absolute || cfg->Relative != DeadbandDefaults[i].Relative
+                    || cfg->MaxAge != DeadbandDefaults[i].MaxAge)
+                {
+                    snprintf(buf, sizeof(buf), "%g,%g,%" PRIu32, cfg->Absolute, cfg->Relative, cfg->MaxAge);
+                    config->Set(key, buf);
+                }
+            }
+
+            if (config->Save() != ESP_OK)
+            {
+                snprintf(detail, size, "saving the configuration failed");
+                return ESP_FAIL;
+            }
+            break;
+
+        default:
+            return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    return ESP_OK;
+}
+
 #ifdef CONFIG_SOLAREDGE_USE_LCD
 void TaskGuiStatusUpdate(void *param)
 {
@@ -117,6 +261,9 @@ void TaskLcdBackLight(void *param)
 
                 ESP_ERROR_CHECK(ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_0, dutyCycle));
                 ESP_ERROR_CHECK(ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_0));
+
+                // the dimmed screen is still read, LVGL keeps it up to date. LVGL only stops when the backlight is off
+                LCDSetActive(pct != 0);
             }
         }
     }
@@ -129,11 +276,12 @@ extern "C" void app_main(void)
 {
 #ifdef CONFIG_SOLAREDGE_USE_LCD
     static TaskGuiUpdate_t dataGui;
-    GuiData_t GuiData;
+    static GuiData_t GuiData;
 #endif // CONFIG_SOLAREDGE_USE_LCD
 
     static modbus mb = modbus();
     uint16_t modbusPort = 0;
+    uint32_t modbusDelay = 0;
     static SolarEdgeSunSpec_t sunspec;
     static SolarEdge_t solaredge;
     static TaskModbus_t data;
@@ -143,8 +291,17 @@ extern "C" void app_main(void)
     Configuration config;
     int lastDOW;
     static MQTT_user_t mqtt_user;
-
-#ifdef CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    static Statistics stats(StatsChannels, sizeof(StatsChannels) / sizeof(StatsChannels[0]));
+    static AlertEngine alerts;
+    static AlertRule_t alertRules[ALERTS_MAX_RULES];
+    static DeadbandFilter deadband;
+    static SampleBatch batch;
+    static InfluxSink influx;
+    static HistoryStore history(HistoryChannels, sizeof(HistoryChannels) / sizeof(HistoryChannels[0]));
+    AlertEvent_t alertEvents[ALERTS_MAX_RULES];
+    uint32_t stats_window = STATS_DEFAULT_WINDOW;
+
+#ifdef CONFIG_SOLAREDGE_DUMP_TASK_STATS
     char buf[1024];
 #endif
 
@@ -152,8 +309,14 @@ extern "C" void app_main(void)
     data.mb = &mb;
     data.solaredge = &solaredge;
     data.sunspec = &sunspec;
+    data.num_aggregators = 0;
+    data.query_delay = MODBUS_QUERY_DELAY;
+    data.burst_end = 0;
+    memset(&data.mbstats, 0, sizeof(data.mbstats));
 
     solaredge.I_AC_Energy_WH_Last24H = 0;
+    solaredge.I_AC_Energy_WH_Frac = 0;
+    solaredge.I_AC_Energy_WH_Last24H_Frac = 0;
     lastDOW = -1;
 
 #if 1
@@ -198,6 +361,9 @@ extern "C" void app_main(void)
 
     GUI_Setup(&GuiData);
 
+    data.aggregators[data.num_aggregators++] = GuiData.agg_Power_1H;
+    data.aggregators[data.num_aggregators++] = GuiData.agg_Power_24H;
+
     if (xTaskCreate(TaskLcdBackLight, "LCDBackLight", configMINIMAL_STACK_SIZE * 2, &GuiData, 4, nullptr) != pdPASS)
         ESP_LOGE(TAG, "xTaskCreate( TaskLcdBackLight ): failed");
 
@@ -241,6 +407,8 @@ extern "C" void app_main(void)
 #endif
 
     sscanf(config.Get(JS_MBPORT), "%" PRIu16, &modbusPort);
+    if (config.Get(JS_MBDELAY) && sscanf(config.Get(JS_MBDELAY), "%" PRIu32, &modbusDelay) == 1 && modbusDelay >= COMMAND_POLL_MIN)
+        data.query_delay = modbusDelay;
     mb.SetHost(config.Get(JS_MBIP), modbusPort);
 
     mb.SetSlaveID(1);
@@ -248,6 +416,35 @@ extern "C" void app_main(void)
     if (xTaskCreate(TaskModbus, "Modbus", configMINIMAL_STACK_SIZE * 4, &data, 4, nullptr) != pdPASS)
         ESP_LOGE(TAG, "xTaskCreate( TaskModbus ): failed");
 
+    httpd_handle_t httpServer = HttpServerStart();
+
+    if (MetricsRegister(httpServer, &data) != ESP_OK)
+        ESP_LOGE(TAG, "MetricsRegister(): failed");
+
+    if (WsStreamRegister(httpServer) != ESP_OK)
+        ESP_LOGE(TAG, "WsStreamRegister(): failed");
+
+    if (history.Init() != ESP_OK)
+        ESP_LOGE(TAG, "history.Init(): failed");
+
+    if (DashboardRegister(httpServer, &history) != ESP_OK)
+        ESP_LOGE(TAG, "DashboardRegister(): failed");
+
+    const char *influxUri = config.Get(JS_INFLUX_URI);
+    if (influxUri && influxUri[0])
+    {
+        uint16_t influxBatch = INFLUX_DEFAULT_BATCH;
+        uint32_t influxFlush = INFLUX_DEFAULT_FLUSH;
+
+        if (config.Get(JS_INFLUX_BATCH))
+            sscanf(config.Get(JS_INFLUX_BATCH), "%" PRIu16, &influxBatch);
+        if (config.Get(JS_INFLUX_FLUSH))
+            sscanf(config.Get(JS_INFLUX_FLUSH), "%" PRIu32, &influxFlush);
+
+        if (influx.Configure(influxUri, config.Get(JS_INFLUX_MEAS), influxBatch, influxFlush) != ESP_OK || influx.Start() != ESP_OK)
+            ESP_LOGE(TAG, "InfluxDB sink failed to start");
+    }
+
     memset(&mqtt_cfg, 0, sizeof(mqtt_cfg));
 
     const char *mqttHost = config.Get(JS_MQTT_URI);
@@ -258,12 +455,61 @@ extern "C" void app_main(void)
 
     sscanf(config.Get(JS_MQTT_FREQ), "%" PRIu16, &mqtt_freq);
 
+    if (config.Get(JS_STATS_WINDOW))
+        sscanf(config.Get(JS_STATS_WINDOW), "%" PRIu32, &stats_window);
+    if (stats.SetWindow(stats_window) != ESP_OK)
+        ESP_LOGW(TAG, "Statistics window of %" PRIu32 " seconds does not divide a day, using %d", stats_window, STATS_DEFAULT_WINDOW);
+
+    // default alert rules, with the thresholds overruled by the configuration
+    for (uint8_t i = 0; i != AlertNumDefaultRules; i++)
+    {
+        char key[48];
+        float set, clear;
+        uint32_t duration;
+
+        alertRules[i] = AlertDefaultRules[i];
+
+        snprintf(key, sizeof(key), JS_ALERT_PREFIX "%s", alertRules[i].Name);
+        const char *value = config.Get(key);
+
+        if (value && sscanf(value, "%f,%f,%" PRIu32, &set, &clear, &duration) == 3)
+        {
+            alertRules[i].Set = set;
+            alertRules[i].Clear = clear;
+            alertRules[i].MinDuration = duration;
+        }
+    }
+
+    if (alerts.Compile(alertRules, AlertNumDefaultRules) != ESP_OK)
+        ESP_LOGE(TAG, "Invalid alert rules");
+
+    // default deadbands for per field publishing, overruled by the configuration
+    for (int ch = 0; ch != CH_MAX; ch++)
+    {
+        char key[48];
+        DeadbandCfg_t cfg;
+
+        snprintf(key, sizeof(key), JS_DEADBAND_PREFIX "%s", SE_Channels[ch].Name);
+        const char *value = config.Get(key);
+
+        if (value && sscanf(value, "%f,%f,%" PRIu32, &cfg.Absolute, &cfg.Relative, &cfg.MaxAge) == 3)
+            deadband.Configure((SEChannel_t)ch, &cfg);
+    }
+
     if (mqttHost)
     {
+        static char lwtTopic[128];
+
+        snprintf(lwtTopic, sizeof(lwtTopic), "%s/" MQTT_AVAILABILITY_TOPIC, mqttTopic);
+
         mqtt_cfg.broker.address.uri = mqttHost;
         mqtt_cfg.credentials.client_id = NULL;
         mqtt_cfg.credentials.username = mqttUser;
         mqtt_cfg.credentials.authentication.password = mqttPass;
+        mqtt_cfg.session.last_will.topic = lwtTopic;
+        mqtt_cfg.session.last_will.msg = MQTT_OFFLINE;
+        mqtt_cfg.session.last_will.qos = 1;
+        mqtt_cfg.session.last_will.retain = 1;
 
         ESP_LOGI(TAG, "MQTT host: %s", mqtt_cfg.broker.address.uri);
 
@@ -273,8 +519,14 @@ extern "C" void app_main(void)
             mqtt_user.mqtt_client = mqtt_client;
             mqtt_user.mqtt_ha_topic = mqttTopicHA;
             mqtt_user.mqtt_topic = mqttTopic;
+            mqtt_user.formats = MQTT_ParseFormats(config.Get(JS_MQTT_FORMAT));
+            if (!mqtt_user.formats)
+                mqtt_user.formats = MQTT_FORMAT_JSON;
+            mqtt_user.deadband = &deadband;
+            mqtt_user.commands = xQueueCreate(COMMAND_QUEUE_SIZE, sizeof(Command_t));
 
             esp_mqtt_client_register_event(mqtt_client, MQTT_EVENT_CONNECTED, mqtt_event_handler, &mqtt_user);
+            esp_mqtt_client_register_event(mqtt_client, MQTT_EVENT_DATA, mqtt_event_handler, &mqtt_user);
             ESP_LOGI(TAG, "MQTT client started");
         }
         else
@@ -302,24 +554,85 @@ extern "C" void app_main(void)
             GUI_UpdatePanels(&GuiData, data.solaredge);
 #endif // CONFIG_SOLAREDGE_USE_LCD
 
+            // the discovery contains the identity of the inverter, wait for the first sample
+            if (mqtt_user.discovery_pending && data.sunspec->C_SerialNumber[0])
+            {
+                mqtt_user.discovery_pending = false;
+                PublishDiscoveryMQTT(&mqtt_user, &data);
+            }
+
+            if (mqtt_user.schema_pending && (mqtt_user.formats & MQTT_FORMAT_CBOR) && PublishSchemaMQTT(&mqtt_user) == ESP_OK)
+                mqtt_user.schema_pending = false;
+
+            // commands from <topic>/cmd, applied between two samples
+            Command_t cmd;
+            while (mqtt_user.commands && xQueueReceive(mqtt_user.commands, &cmd, 0) == pdTRUE)
+            {
+                char detail[384];
+                esp_err_t err = ApplyCommand(&cmd, &data, &mqtt_user, &mqtt_freq, &config, detail, sizeof(detail));
+
+                PublishAckMQTT(&mqtt_user, &cmd, err, detail[0] ? detail : nullptr);
+            }
+
+            // during a burst every sample is published
+            bool burst = (uint32_t)(esp_timer_get_time() / 1000000LL) < data.burst_end;
+
             static time_t mqtt_timer = time(NULL) + mqtt_freq;
-            if (mqtt_timer <= time(NULL))
+            if (mqtt_timer <= time(NULL) || burst)
             {
                 mqtt_timer = time(NULL) + mqtt_freq;
                 PublishMQTT(&mqtt_user, &data);
             }
 
+            // the deadband decides per field, every sample is a candidate
+            if (mqtt_user.formats & MQTT_FORMAT_FIELDS)
+                PublishFieldsMQTT(&mqtt_user, &data);
+
+            influx.Push(data.solaredge);
+            WsStreamPush(data.solaredge);
+
+            // every sample goes in the batch, the mqtt frequency is the maximum latency
+            if (mqtt_user.formats & MQTT_FORMAT_BATCH)
+            {
+                batch.Add(data.solaredge);
+
+                if (batch.Full() || batch.GetLatency(data.solaredge->Timestamp) >= (int64_t)mqtt_freq * 1000000LL)
+                    PublishBatchMQTT(&mqtt_user, &batch);
+            }
+
             time_t t = time(NULL);
+
+            uint8_t numEvents = alerts.Evaluate(data.solaredge, alertEvents, ALERTS_MAX_RULES);
+            for (uint8_t i = 0; i != numEvents; i++)
+                PublishAlertMQTT(&mqtt_user, &alertEvents[i]);
+
+            if (mqtt_user.alerts_stale && PublishAlertStatesMQTT(&mqtt_user, &alerts) == ESP_OK)
+                mqtt_user.alerts_stale = false;
+
+            if (NTPTimeSynced)
+            {
+                if (stats.WindowClosed(t))
+                {
+                    if (stats.GetDigest(0)->Count())
+                        PublishStatsMQTT(&mqtt_user, &stats);
+
+                    stats.Reset(t);
+                }
+
+                stats.Add(data.solaredge);
+                history.Add(t, data.solaredge);
+            }
+
             struct tm *ltm = localtime(&t);
 
             if (ltm->tm_mday != lastDOW)
             {
                 lastDOW = ltm->tm_mday;
-                solaredge.I_AC_Energy_WH_Last24H = solaredge.I_AC_Energy_WH;
+                SE_SetMidnight(&solaredge);
             }
         }
 
-#ifdef CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+#ifdef CONFIG_SOLAREDGE_DUMP_TASK_STATS
         vTaskGetRunTimeStats(buf);
         printf("\n%s\n", buf);
         printf("HEAP: %" PRIi32 "\n", esp_get_free_heap_size());
@@ -224,6 +224,7 @@ esp_err_t modbus::ConvertRegisters(SolarEdgeSunSpec_t *ss, SolarEdge_t *sf)
     memcpy(sf->C_Model, ss->C_Model, sizeof(ss->C_Model));
     memcpy(sf->C_Version, ss->C_Version, sizeof(ss->C_Version));
     memcpy(sf->C_SerialNumber, ss->C_SerialNumber, sizeof(ss->C_SerialNumber));
+    sf->C_SunSpec_Phase = ss->C_SunSpec_Phase;
 
     sf->I_AC_Current = ss->I_AC_Current * (pow10(ss->I_AC_Current_SF));
     sf->I_AC_CurrentA = ss->I_AC_CurrentA * (pow10(ss->I_AC_Current_SF));
@@ -5,6 +5,20 @@
 
 #include "sunspec.h"
 #include "modbus.h"
+#include "Aggregator.h"
+#include "Seqlock.h"
+
+#define TASKMODBUS_MAX_AGGREGATORS 4
+
+// health of the modbus connection, only written by TaskModbus
+typedef struct
+{
+    uint32_t requests;   // successful reads
+    uint32_t errors;     // failed reads
+    uint32_t reconnects; // connections made again after a disconnect or an error
+    uint32_t rtt_us;     // round trip time of the last read
+    uint32_t rtt_max_us; // longest round trip time since boot
+} ModbusStats_t;
 
 typedef struct
 {
@@ -12,4 +26,10 @@ typedef struct
     SemaphoreHandle_t lock;
     SolarEdgeSunSpec_t *sunspec;
     SolarEdge_t *solaredge;
+    IntervalAggregator *aggregators[TASKMODBUS_MAX_AGGREGATORS]; // fed with every sample by TaskModbus
+    uint8_t num_aggregators;
+    volatile uint32_t query_delay; // ms between requests, can be changed at runtime
+    volatile uint32_t burst_end;   // uptime in seconds until which every sample is requested as fast as possible
+    Seqlock<SolarEdge_t> snapshot; // copy of every sample, for readers that must not block TaskModbus
+    ModbusStats_t mbstats;
 } TaskModbus_t;
@@ -1,81046 +0,0 @@
-#ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
-#define LV_LVGL_H_INCLUDE_SIMPLE
-#endif
-#endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_SE_LOGO
-#define LV_ATTRIBUTE_IMG_SE_LOGO
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SE_LOGO uint8_t se_logo_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-    /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xdf,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xdf,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xdf,
-    0xdb,
-    0xdb,
-    0xdf,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xdf,
-    0xdb,
-    0xdb,
-    0xdf,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xdf,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe4,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xc9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe4,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xc9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdb,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xc9,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdb,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xc9,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xc9,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe4,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xc9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xc9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xc9,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe4,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdb,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdb,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe0,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xc9,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xc9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe4,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-    /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5b,
-    0xdf,
-    0xfc,
-    0xe6,
-    0xfc,
-    0xe6,
-    0xfc,
-    0xe6,
-    0xfc,
-    0xe6,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x26,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x26,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x24,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xd8,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x45,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xf8,
-    0xc7,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xd6,
-    0xf8,
-    0xc7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xf8,
-    0xc7,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xd6,
-    0xf8,
-    0xc7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xf8,
-    0xc7,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xd6,
-    0xf8,
-    0xc7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xf8,
-    0xc7,
-    0xf8,
-    0xc7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x5d,
-    0xef,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5b,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe4,
-    0xe0,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xe1,
-    0x25,
-    0xd9,
-    0x25,
-    0xe1,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x08,
-    0xc2,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xdb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3b,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x45,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x06,
-    0xe1,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xe4,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xde,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xe5,
-    0xd8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xbb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xe6,
-    0xe8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x45,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x08,
-    0xc2,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x5d,
-    0xd7,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdb,
-    0xde,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x7a,
-    0xd6,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x26,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x04,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xa6,
-    0xd1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xc6,
-    0xd0,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x7a,
-    0xd6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xa6,
-    0xd1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x24,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x04,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0xc7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x7b,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x5b,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xa6,
-    0xd1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x06,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0xfc,
-    0xe6,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x5d,
-    0xef,
-    0xbb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xd8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xe4,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xd8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xd8,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x5b,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x5d,
-    0xef,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xfc,
-    0xe6,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x7a,
-    0xd6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x06,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x25,
-    0xd9,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x06,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xa6,
-    0xd1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xa6,
-    0xd1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xdb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xa6,
-    0xd1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x45,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xdb,
-    0xde,
-    0xfb,
-    0xde,
-    0x1c,
-    0xdf,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0xe1,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xde,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xe6,
-    0xe8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xd8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0xe5,
-    0xd8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdb,
-    0xde,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfc,
-    0xe6,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x45,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xde,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xde,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x04,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xe4,
-    0xe0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7a,
-    0xd6,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5d,
-    0xd7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7a,
-    0xd6,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x26,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfb,
-    0xde,
-    0xfb,
-    0xde,
-    0xfb,
-    0xde,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xde,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0xfb,
-    0xde,
-    0xfb,
-    0xde,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x25,
-    0xe1,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0xf8,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x06,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x06,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xbb,
-    0xde,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xe6,
-    0xe8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xc6,
-    0xd0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x06,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xbb,
-    0xde,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xfc,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x06,
-    0xe1,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe6,
-    0xe8,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe5,
-    0xd8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x06,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3d,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xdb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xbb,
-    0xde,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xfc,
-    0xe6,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0xff,
-    0xff,
-    0xfc,
-    0xe6,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x5d,
-    0xd7,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0xdb,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x06,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x06,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xc6,
-    0xd0,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x45,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xa6,
-    0xd1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x04,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x65,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x24,
-    0xe1,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0xa6,
-    0xd1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe4,
-    0xe0,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x45,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x26,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-    /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x5b,
-    0xe6,
-    0xfc,
-    0xe6,
-    0xfc,
-    0xe6,
-    0xfc,
-    0xe6,
-    0xfc,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xe1,
-    0x26,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xe1,
-    0x26,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x24,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd8,
-    0xe5,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x45,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc7,
-    0xf8,
-    0xd6,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xc7,
-    0xf8,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc7,
-    0xf8,
-    0xd6,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xc7,
-    0xf8,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc7,
-    0xf8,
-    0xd6,
-    0x7a,
-    0xd6,
-    0x7a,
-    0xc7,
-    0xf8,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xc7,
-    0xf8,
-    0xc7,
-    0xf8,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xef,
-    0x5d,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x5b,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe4,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x25,
-    0xd9,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xc2,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xdb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x3b,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x45,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x06,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe0,
-    0xe4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xfb,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd8,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xbb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe8,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x45,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xc2,
-    0x08,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xd7,
-    0x5d,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xdb,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xd6,
-    0x7a,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x26,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x06,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd1,
-    0xa6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd0,
-    0xc6,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xd6,
-    0x7a,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd1,
-    0xa6,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x24,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xc7,
-    0xf8,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x7b,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x5b,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd1,
-    0xa6,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xdf,
-    0x1c,
-    0xe6,
-    0xfc,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0xef,
-    0x5d,
-    0xde,
-    0xbb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd8,
-    0xe5,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe0,
-    0xe4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd8,
-    0xe5,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd8,
-    0xe5,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x5b,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xef,
-    0x5d,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe6,
-    0xfc,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xd6,
-    0x7a,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x04,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x25,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x26,
-    0xe1,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd1,
-    0xa6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd1,
-    0xa6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xdb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd1,
-    0xa6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x45,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xde,
-    0xdb,
-    0xde,
-    0xfb,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x06,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xfb,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x06,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe8,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd8,
-    0xe5,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd8,
-    0xe5,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xdb,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe6,
-    0xfc,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x45,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x04,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xfb,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xfb,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe0,
-    0xe4,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd6,
-    0x7a,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd7,
-    0x5d,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd6,
-    0x7a,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x26,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xfb,
-    0xde,
-    0xfb,
-    0xde,
-    0xfb,
-    0xe7,
-    0x3c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xfb,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0xe6,
-    0xfc,
-    0xde,
-    0xfb,
-    0xde,
-    0xfb,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xf8,
-    0x00,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x06,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x3c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xbb,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe8,
-    0xe6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd0,
-    0xc6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xbb,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe6,
-    0xfc,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x3c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x06,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe8,
-    0xe6,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd8,
-    0xe5,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0x3d,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xdb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xde,
-    0xbb,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xe6,
-    0xfc,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xff,
-    0xff,
-    0xe6,
-    0xfc,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xd7,
-    0x5d,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe7,
-    0x1c,
-    0xdf,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xe7,
-    0x1c,
-    0xde,
-    0xdb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd0,
-    0xc6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x45,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd1,
-    0xa6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x04,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x25,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x65,
-    0xd9,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x25,
-    0xe1,
-    0x24,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd1,
-    0xa6,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe0,
-    0xe4,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xf8,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x45,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xe1,
-    0x26,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x65,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xf8,
-    0x00,
-    0xd9,
-    0x25,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xd9,
-    0x05,
-    0xe1,
-    0x05,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-    /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xd9,
-    0xe6,
-    0xd9,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0xe1,
-    0xe1,
-    0xe1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x23,
-    0x23,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x26,
-    0x1c,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x21,
-    0xd8,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xd7,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xde,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x27,
-    0xd8,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x22,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdc,
-    0xe2,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe6,
-    0xe6,
-    0xe6,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xd9,
-    0xe6,
-    0xd9,
-    0xff,
-    0xde,
-    0xe1,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xe1,
-    0xe1,
-    0xdb,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xde,
-    0xe1,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe2,
-    0xe2,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x1c,
-    0x1c,
-    0xe3,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x29,
-    0x21,
-    0xdb,
-    0xff,
-    0x2a,
-    0x22,
-    0xd9,
-    0xff,
-    0x28,
-    0x23,
-    0xdc,
-    0xff,
-    0x29,
-    0x23,
-    0xdc,
-    0xff,
-    0x28,
-    0x22,
-    0xd7,
-    0xff,
-    0x27,
-    0x23,
-    0xd8,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x27,
-    0x22,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x22,
-    0xd7,
-    0xff,
-    0x26,
-    0x21,
-    0xd9,
-    0xff,
-    0x2a,
-    0x22,
-    0xd9,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x27,
-    0x22,
-    0xda,
-    0xff,
-    0x27,
-    0x1f,
-    0xdc,
-    0xff,
-    0x26,
-    0x21,
-    0xd9,
-    0xff,
-    0x27,
-    0x21,
-    0xd8,
-    0xff,
-    0x27,
-    0x1f,
-    0xdc,
-    0xff,
-    0x29,
-    0x21,
-    0xdb,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x27,
-    0x22,
-    0xda,
-    0xff,
-    0x27,
-    0x22,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x26,
-    0x21,
-    0xd9,
-    0xff,
-    0x29,
-    0x23,
-    0xdc,
-    0xff,
-    0x28,
-    0x22,
-    0xd7,
-    0xff,
-    0x28,
-    0x23,
-    0xdc,
-    0xff,
-    0x27,
-    0x20,
-    0xdc,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x27,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x40,
-    0x40,
-    0xbf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdd,
-    0xe3,
-    0xdd,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdb,
-    0xe4,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdd,
-    0xe3,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x27,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x29,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x2c,
-    0x21,
-    0xde,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x29,
-    0x23,
-    0xdc,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x1c,
-    0x1c,
-    0xe3,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdd,
-    0xe2,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2b,
-    0x23,
-    0xdc,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x1f,
-    0xd6,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x1b,
-    0xd7,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x20,
-    0xd7,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd7,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe2,
-    0xe2,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xd4,
-    0xd4,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x33,
-    0x1a,
-    0xe6,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x1f,
-    0xdc,
-    0xff,
-    0x27,
-    0x27,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x23,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x40,
-    0x40,
-    0xbf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe1,
-    0xdb,
-    0xff,
-    0xe8,
-    0xe8,
-    0xd1,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xde,
-    0xe1,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xde,
-    0xe1,
-    0xdc,
-    0xff,
-    0xe1,
-    0xe1,
-    0xdc,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xdd,
-    0xe2,
-    0xdd,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe1,
-    0xe1,
-    0xe1,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe1,
-    0xe1,
-    0xdb,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xe1,
-    0xe1,
-    0xe1,
-    0xff,
-    0xde,
-    0xe0,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdb,
-    0xff,
-    0xde,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xdf,
-    0xda,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x27,
-    0x22,
-    0xd9,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x20,
-    0x20,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x27,
-    0x20,
-    0xdb,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x30,
-    0x20,
-    0xdf,
-    0xff,
-    0x29,
-    0x20,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x33,
-    0x33,
-    0xcc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2e,
-    0x17,
-    0xd1,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xda,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xde,
-    0xda,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdc,
-    0xe2,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdd,
-    0xe1,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x33,
-    0x33,
-    0xcc,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2a,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x23,
-    0x23,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x20,
-    0x20,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x1f,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x1f,
-    0xd6,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xbf,
-    0xff,
-    0xbf,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xe1,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xd4,
-    0xea,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x22,
-    0xdd,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xd7,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xd7,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdb,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xd9,
-    0xe6,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x23,
-    0xdc,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x22,
-    0xdd,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x33,
-    0x33,
-    0xcc,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x30,
-    0x20,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdd,
-    0xe2,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xd8,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0xe1,
-    0xe1,
-    0xe1,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0xe6,
-    0xe6,
-    0xe6,
-    0xff,
-    0xd4,
-    0xd4,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xe1,
-    0xe1,
-    0xd9,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x26,
-    0x22,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x26,
-    0x1c,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x1c,
-    0x1c,
-    0xe3,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x1d,
-    0xd8,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x1d,
-    0xd8,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0xde,
-    0xe1,
-    0xdb,
-    0xff,
-    0xd9,
-    0xe6,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe6,
-    0xe6,
-    0xe6,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x20,
-    0x20,
-    0xdf,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x30,
-    0x20,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x20,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x22,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x22,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x22,
-    0xdd,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x2c,
-    0x21,
-    0xde,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xda,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x22,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x22,
-    0xdd,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x33,
-    0x33,
-    0xcc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x22,
-    0xdd,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x33,
-    0x33,
-    0xcc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x26,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x22,
-    0xdd,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x33,
-    0x33,
-    0xcc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x26,
-    0x26,
-    0xd9,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xd8,
-    0xff,
-    0xdd,
-    0xe3,
-    0xdd,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xdf,
-    0xdf,
-    0xda,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xe3,
-    0xe3,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdd,
-    0xe3,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2c,
-    0x21,
-    0xde,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x1f,
-    0xdc,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x23,
-    0xd8,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x22,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2b,
-    0x23,
-    0xdc,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x1f,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdd,
-    0xe1,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x29,
-    0x20,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x30,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x33,
-    0x1a,
-    0xe6,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x1b,
-    0xd7,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x2b,
-    0x1c,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdd,
-    0xdd,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe1,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x1f,
-    0xd8,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x26,
-    0x20,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x1f,
-    0xd6,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x26,
-    0x26,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x20,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x27,
-    0x20,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdd,
-    0xe3,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x20,
-    0x20,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x1f,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x1c,
-    0x1c,
-    0xe3,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x2b,
-    0x23,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x23,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe1,
-    0xe1,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe8,
-    0xe8,
-    0xd1,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdb,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xcc,
-    0xcc,
-    0xcc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x1f,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x26,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x26,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x26,
-    0x21,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x23,
-    0xd8,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0xde,
-    0xe1,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe1,
-    0xe1,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdd,
-    0xe2,
-    0xdd,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xdb,
-    0xdb,
-    0xdb,
-    0xff,
-    0xe1,
-    0xe1,
-    0xd9,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x26,
-    0x20,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x28,
-    0x23,
-    0xdc,
-    0xff,
-    0x28,
-    0x22,
-    0xd9,
-    0xff,
-    0x29,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xda,
-    0xff,
-    0x29,
-    0x20,
-    0xda,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x1f,
-    0xd6,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x2a,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x30,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xda,
-    0xff,
-    0x29,
-    0x20,
-    0xdb,
-    0xff,
-    0x29,
-    0x1f,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x25,
-    0x1e,
-    0xd9,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x27,
-    0x22,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdd,
-    0xe3,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x22,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x29,
-    0x21,
-    0xde,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x1f,
-    0xd8,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x2d,
-    0x1e,
-    0xe1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x28,
-    0x22,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x2d,
-    0x1e,
-    0xe1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x23,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xd4,
-    0xd4,
-    0xd4,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x33,
-    0x1a,
-    0xe6,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x2e,
-    0x17,
-    0xd1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2d,
-    0x1e,
-    0xe1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x23,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe3,
-    0xe3,
-    0xe3,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xd4,
-    0xd4,
-    0xd4,
-    0xff,
-    0xde,
-    0xe0,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe1,
-    0xe1,
-    0xe1,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdd,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdc,
-    0xe3,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xdb,
-    0xff,
-    0x2c,
-    0x21,
-    0xde,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x33,
-    0x1a,
-    0xe6,
-    0xff,
-    0x2a,
-    0x22,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x2a,
-    0x21,
-    0xd9,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x1b,
-    0xd7,
-    0xff,
-    0x29,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x29,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2d,
-    0x1e,
-    0xe1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x20,
-    0xdb,
-    0xff,
-    0x27,
-    0x1f,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xe4,
-    0xe4,
-    0xd7,
-    0xff,
-    0xdd,
-    0xe1,
-    0xdd,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdd,
-    0xff,
-    0xe1,
-    0xe1,
-    0xdc,
-    0xff,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xd4,
-    0xd4,
-    0xd4,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xe1,
-    0xe1,
-    0xe1,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xdd,
-    0xe1,
-    0xdd,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdc,
-    0xff,
-    0xde,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xdf,
-    0xe0,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xdf,
-    0xe1,
-    0xdb,
-    0xff,
-    0xde,
-    0xe0,
-    0xdb,
-    0xff,
-    0xe0,
-    0xe0,
-    0xd8,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xdc,
-    0xdc,
-    0xdc,
-    0xff,
-    0xde,
-    0xe1,
-    0xdb,
-    0xff,
-    0xde,
-    0xe1,
-    0xdc,
-    0xff,
-    0xde,
-    0xe1,
-    0xdc,
-    0xff,
-    0xde,
-    0xe1,
-    0xdc,
-    0xff,
-    0xe0,
-    0xe0,
-    0xdd,
-    0xff,
-    0xe8,
-    0xe8,
-    0xd1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xde,
-    0xde,
-    0xde,
-    0xff,
-    0xde,
-    0xe1,
-    0xdb,
-    0xff,
-    0xde,
-    0xe1,
-    0xdc,
-    0xff,
-    0xde,
-    0xe1,
-    0xdc,
-    0xff,
-    0xde,
-    0xe1,
-    0xdc,
-    0xff,
-    0xdf,
-    0xdf,
-    0xdd,
-    0xff,
-    0xd8,
-    0xd8,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x27,
-    0x22,
-    0xdb,
-    0xff,
-    0x27,
-    0x22,
-    0xdb,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x27,
-    0x22,
-    0xdb,
-    0xff,
-    0x29,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x22,
-    0xd9,
-    0xff,
-    0x27,
-    0x22,
-    0xdb,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x27,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2d,
-    0x1e,
-    0xe1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xd9,
-    0xff,
-    0x27,
-    0x20,
-    0xda,
-    0xff,
-    0x27,
-    0x22,
-    0xdb,
-    0xff,
-    0x27,
-    0x22,
-    0xdb,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x28,
-    0x22,
-    0xdb,
-    0xff,
-    0x27,
-    0x22,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x22,
-    0xd7,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2d,
-    0x1e,
-    0xe1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x21,
-    0xde,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2e,
-    0x17,
-    0xd1,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x1f,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xd9,
-    0xff,
-    0x27,
-    0x27,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x22,
-    0xd7,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x33,
-    0x33,
-    0xcc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x1f,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x22,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x22,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x20,
-    0x20,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x20,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x20,
-    0x20,
-    0xdf,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x20,
-    0xda,
-    0xff,
-    0x29,
-    0x20,
-    0xdb,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x27,
-    0x22,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2b,
-    0x23,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x24,
-    0x24,
-    0xdb,
-    0xff,
-    0x29,
-    0x22,
-    0xdd,
-    0xff,
-    0x29,
-    0x22,
-    0xdd,
-    0xff,
-    0x23,
-    0x23,
-    0xdc,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x22,
-    0xdd,
-    0xff,
-    0x27,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x2a,
-    0x1f,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x21,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x33,
-    0x33,
-    0xcc,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x1c,
-    0x1c,
-    0xe3,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x21,
-    0xdb,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x29,
-    0x1f,
-    0xd9,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x27,
-    0x27,
-    0xd8,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x2c,
-    0x23,
-    0xdc,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x21,
-    0xdb,
-    0xff,
-    0x2a,
-    0x2a,
-    0xd4,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x27,
-    0x1f,
-    0xd8,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x25,
-    0x1e,
-    0xd9,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x26,
-    0x22,
-    0xd9,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x28,
-    0x20,
-    0xdb,
-    0xff,
-    0x29,
-    0x21,
-    0xda,
-    0xff,
-    0x2a,
-    0x20,
-    0xdf,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-#endif
-};
-
-const lv_img_dsc_t se_logo = {
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 200,
-    .header.h = 45,
-    .data_size = 9000 * LV_COLOR_SIZE / 8,
-    .data = se_logo_map,
-};
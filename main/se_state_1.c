@@ -1,2647 +0,0 @@
-#ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
-#define LV_LVGL_H_INCLUDE_SIMPLE
-#endif
-#endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_SE_STATE_1
-#define LV_ATTRIBUTE_IMG_SE_STATE_1
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SE_STATE_1 uint8_t se_state_1_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-    /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xf7,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0x00,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xf7,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xff,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0x00,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xf7,
-    0x00,
-    0x00,
-    0xff,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfb,
-    0xfb,
-    0xf7,
-    0xfb,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-    /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xdf,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xde,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x00,
-    0x00,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x00,
-    0x00,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xff,
-    0xff,
-    0xdf,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x7e,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xbf,
-    0xfe,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xde,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xbe,
-    0xfd,
-    0x9f,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-    /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfd,
-    0xdf,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x9e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfd,
-    0xff,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0x00,
-    0x00,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0x00,
-    0x00,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xff,
-    0xff,
-    0xfd,
-    0xdf,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0x7e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfe,
-    0xbf,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfd,
-    0xfe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xbe,
-    0xfd,
-    0xde,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xfd,
-    0xbe,
-    0xfd,
-    0x9f,
-    0xfd,
-    0x9e,
-    0xfd,
-    0xbe,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-    /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf7,
-    0xb7,
-    0xff,
-    0xff,
-    0xf2,
-    0xb1,
-    0xff,
-    0xff,
-    0xf2,
-    0xb1,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb1,
-    0xff,
-    0xff,
-    0xf3,
-    0xaf,
-    0xff,
-    0xff,
-    0xf1,
-    0xb0,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf1,
-    0xb0,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb1,
-    0xff,
-    0xff,
-    0xf0,
-    0xb9,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb2,
-    0xff,
-    0xff,
-    0xf3,
-    0xb0,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf3,
-    0xb1,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb1,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf4,
-    0xbc,
-    0xff,
-    0xff,
-    0xf2,
-    0xb1,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf1,
-    0xb1,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf3,
-    0xb2,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf3,
-    0xb4,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf3,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf1,
-    0xb4,
-    0xff,
-    0xff,
-    0xf2,
-    0xb2,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf1,
-    0xaf,
-    0xff,
-    0xff,
-    0xf2,
-    0xb1,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf0,
-    0xb4,
-    0xff,
-    0xff,
-    0xf3,
-    0xb0,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb4,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xff,
-    0xf4,
-    0xb7,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb2,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf2,
-    0xb5,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb1,
-    0xff,
-    0xff,
-    0xed,
-    0xad,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0xd4,
-    0xff,
-    0xff,
-    0xf2,
-    0xb2,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb4,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0xbb,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb0,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf3,
-    0xb4,
-    0xff,
-    0xff,
-    0xf3,
-    0xb4,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb3,
-    0xff,
-    0xff,
-    0xf2,
-    0xb2,
-    0xff,
-    0xff,
-    0xf2,
-    0xb4,
-    0xff,
-    0xff,
-    0xf3,
-    0xb6,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0xb4,
-    0xff,
-    0xff,
-    0xf5,
-    0xb1,
-    0xff,
-    0xff,
-    0xf1,
-    0xaf,
-    0xff,
-    0xff,
-    0xf0,
-    0xb4,
-    0xff,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-#endif
-};
-
-const lv_img_dsc_t se_state_1 = {
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 17,
-    .header.h = 17,
-    .data_size = 289 * LV_COLOR_SIZE / 8,
-    .data = se_state_1_map,
-};
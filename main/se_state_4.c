@@ -1,2647 +0,0 @@
-#ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
-#define LV_LVGL_H_INCLUDE_SIMPLE
-#endif
-#endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_SE_STATE_1
-#define LV_ATTRIBUTE_IMG_SE_STATE_1
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SE_STATE_1 uint8_t se_state_4_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-    /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x1a,
-    0x00,
-    0x00,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x00,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x1a,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x12,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x00,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x1a,
-    0x00,
-    0x00,
-    0x15,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1a,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x1a,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x19,
-    0x19,
-    0x19,
-    0x19,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-    /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0b,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x4c,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x0c,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xeb,
-    0x05,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x00,
-    0x00,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x00,
-    0x00,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x10,
-    0x04,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4d,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x6b,
-    0x05,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0xed,
-    0x05,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x2c,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x2b,
-    0x06,
-    0x4c,
-    0x06,
-    0x4c,
-    0x06,
-    0x2b,
-    0x06,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-    /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0x0b,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x4c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x0c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xeb,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x00,
-    0x00,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x00,
-    0x00,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x04,
-    0x10,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4d,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0x6b,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x05,
-    0xed,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x4c,
-    0x06,
-    0x2c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x06,
-    0x2c,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x06,
-    0x2b,
-    0x06,
-    0x4c,
-    0x06,
-    0x4c,
-    0x06,
-    0x2b,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-    /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x58,
-    0xbf,
-    0x00,
-    0xff,
-    0x5d,
-    0xc5,
-    0x00,
-    0xff,
-    0x5e,
-    0xc5,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc5,
-    0x00,
-    0xff,
-    0x5e,
-    0xc6,
-    0x00,
-    0xff,
-    0x5d,
-    0xc6,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x5d,
-    0xc5,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5e,
-    0xc5,
-    0x00,
-    0xff,
-    0x5d,
-    0xc1,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x5e,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc5,
-    0x00,
-    0xff,
-    0x61,
-    0xc8,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x5c,
-    0xc5,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5e,
-    0xc6,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x59,
-    0xbc,
-    0x00,
-    0xff,
-    0x5d,
-    0xc5,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5e,
-    0xc6,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x5e,
-    0xc5,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5c,
-    0xc3,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x60,
-    0xc6,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc2,
-    0x00,
-    0xff,
-    0x5e,
-    0xc5,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5e,
-    0xc7,
-    0x00,
-    0xff,
-    0x5d,
-    0xc5,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5f,
-    0xc3,
-    0x00,
-    0xff,
-    0x5d,
-    0xc5,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x7f,
-    0x7f,
-    0x00,
-    0xff,
-    0x5e,
-    0xc2,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5e,
-    0xc4,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x5d,
-    0xc3,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5e,
-    0xc5,
-    0x00,
-    0xff,
-    0x64,
-    0xc8,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x55,
-    0xaa,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5c,
-    0xc4,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x66,
-    0xbb,
-    0x00,
-    0xff,
-    0x5e,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5e,
-    0xc6,
-    0x00,
-    0xff,
-    0x5d,
-    0xc3,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5c,
-    0xc3,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5d,
-    0xc4,
-    0x00,
-    0xff,
-    0x5e,
-    0xc4,
-    0x00,
-    0xff,
-    0x61,
-    0xc2,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x5a,
-    0xc3,
-    0x00,
-    0xff,
-    0x5e,
-    0xc6,
-    0x00,
-    0xff,
-    0x5e,
-    0xc6,
-    0x00,
-    0xff,
-    0x5a,
-    0xc3,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-#endif
-};
-
-const lv_img_dsc_t se_state_4 = {
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 17,
-    .header.h = 17,
-    .data_size = 289 * LV_COLOR_SIZE / 8,
-    .data = se_state_4_map,
-};
@@ -1,2647 +0,0 @@
-#ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
-#define LV_LVGL_H_INCLUDE_SIMPLE
-#endif
-#endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_SE_STATE_5
-#define LV_ATTRIBUTE_IMG_SE_STATE_5
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SE_STATE_5 uint8_t se_state_5_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-    /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x13,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x0f,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-    /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x5e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x3f,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x1f,
-    0x04,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x7e,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-    /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x5e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x03,
-    0x3f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x1f,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x5e,
-    0x03,
-    0x3e,
-    0x03,
-    0x3e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x03,
-    0x7e,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-    /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xed,
-    0x67,
-    0x00,
-    0xff,
-    0xee,
-    0x65,
-    0x00,
-    0xff,
-    0xed,
-    0x63,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0xef,
-    0x66,
-    0x00,
-    0xff,
-    0xed,
-    0x64,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf3,
-    0x64,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0xef,
-    0x66,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x64,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0xef,
-    0x66,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xef,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xef,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x69,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xef,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0x67,
-    0x00,
-    0xff,
-    0xf1,
-    0x66,
-    0x00,
-    0xff,
-    0xf0,
-    0x69,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf1,
-    0x64,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf5,
-    0x62,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x67,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf0,
-    0x68,
-    0x00,
-    0xff,
-    0xf0,
-    0x66,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf2,
-    0x68,
-    0x00,
-    0xff,
-    0xef,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xee,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xff,
-    0x7f,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xed,
-    0x66,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0xf0,
-    0x65,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0xf2,
-    0x6b,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-    0x00,
-    0x00,
-    0x00,
-    0xff,
-#endif
-};
-
-const lv_img_dsc_t se_state_5 = {
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 17,
-    .header.h = 17,
-    .data_size = 289 * LV_COLOR_SIZE / 8,
-    .data = se_state_5_map,
-};
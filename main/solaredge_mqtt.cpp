@@ -1,8 +1,11 @@
+#include <inttypes.h>
+
 #include <esp_err.h>
 #include <esp_log.h>
 #include <esp_timer.h>
 #include <mqtt_client.h>
 #include <cJSON.h>
+#include <ctype.h>
 
 #include "modbus.h"
 #include "private_types.h"
@@ -10,22 +13,117 @@
 #include "sdkconfig.h"
 
 #include "solaredge_mqtt.h"
+#include "Telemetry.h"
+#include "TextWriter.h"
 
 #define TAG "PublishMQTT"
 
 #define MQTT_DEFAULT_TOPIC "solaredge"
 
-HA_ConfigMsg_T HA_CfgSensors[] = {
-    { "I_AC_Energy_WH", "i_ac_energy_wh", "energy", "total_increasing", "Wh" }, /* data->solaredge->I_AC_Energy_WH */
-    { "I_Temp_Sink", "i_temp_sink", "temperature", "measurement", "°C" }        /* data->solaredge->I_Temp_Sink */
+// home-assistant discovery, one sensor per key of the json document on <topic>
+static const HA_ConfigMsg_T HA_CfgSensors[] = {
+    { "I_AC_Current", "current", "measurement", "A" },
+    { "I_AC_CurrentA", "current", "measurement", "A" },
+    { "I_AC_CurrentB", "current", "measurement", "A" },
+    { "I_AC_CurrentC", "current", "measurement", "A" },
+    { "I_AC_VoltageAB", "voltage", "measurement", "V" },
+    { "I_AC_VoltageBC", "voltage", "measurement", "V" },
+    { "I_AC_VoltageCA", "voltage", "measurement", "V" },
+    { "I_AC_VoltageAN", "voltage", "measurement", "V" },
+    { "I_AC_VoltageBN", "voltage", "measurement", "V" },
+    { "I_AC_VoltageCN", "voltage", "measurement", "V" },
+    { "I_AC_Power", "power", "measurement", "W" },
+    { "I_AC_Frequency", "frequency", "measurement", "Hz" },
+    { "I_AC_VA", "apparent_power", "measurement", "VA" },
+    { "I_AC_VAR", "reactive_power", "measurement", "var" },
+    { "I_AC_PF", "power_factor", "measurement", "%" },
+    { "I_AC_Energy_WH", "energy", "total_increasing", "Wh" },
+    { "I_AC_Energy_WH_24H", "energy", "total_increasing", "Wh" },
+    { "I_DC_Current", "current", "measurement", "A" },
+    { "I_DC_Voltage", "voltage", "measurement", "V" },
+    { "I_DC_Power", "power", "measurement", "W" },
+    { "I_DC_AC_Efficiency", nullptr, "measurement", "%" },
+    { "I_Temp_Sink", "temperature", "measurement", "°C" },
+    { "I_Status", nullptr, nullptr, nullptr },
+    { "I_Status_Vendor", nullptr, nullptr, nullptr },
 };
 
-esp_err_t PublishMQTT(MQTT_user_t *mqtt_user, TaskModbus_t *data)
+//
+// comma separated list of formats, 0 when it is empty or contains an unknown format
+//
+uint32_t MQTT_ParseFormats(const char *formats)
+{
+    static const char *names[] = { "json", "cbor", "fields", "batch" };
+    uint32_t mask = 0;
+
+    while (formats && *formats)
+    {
+        size_t len = strcspn(formats, ", ");
+        size_t i;
+
+        for (i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+        {
+            if (len && strlen(names[i]) == len && strncmp(names[i], formats, len) == 0)
+                break;
+        }
+
+        if (len && i == sizeof(names) / sizeof(names[0]))
+            return 0;
+        if (len)
+            mask |= 1 << i;
+
+        formats += len;
+        formats += strspn(formats, ", ");
+    }
+
+    return mask;
+}
+
+void MQTT_FormatsString(uint32_t mask, char *buf, size_t size)
 {
-    char topic_buf[128], message_buf[64];
+    static const char *names[] = { "json", "cbor", "fields", "batch" };
+    TextWriter out(buf, size);
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+    {
+        if (mask & (1 << i))
+            out.Printf(out.Length() ? ",%s" : "%s", names[i]);
+    }
+}
+
+static esp_err_t PublishCBOR(MQTT_user_t *mqtt_user, TaskModbus_t *data)
+{
+    static uint8_t cbor_buf[TELEMETRY_MAX_SIZE];
+    char topic_buf[128];
+
+    int64_t start = esp_timer_get_time();
+    size_t len = TelemetryEncodeCBOR(data->solaredge, start / (1000 * 1000), cbor_buf, sizeof(cbor_buf));
+
+    mqtt_user->stats.cbor_us = esp_timer_get_time() - start;
+    mqtt_user->stats.cbor_bytes = len;
 
+    if (len == 0)
+        return ESP_FAIL;
+
+    snprintf(topic_buf, sizeof(topic_buf), "%s/cbor", mqtt_user->mqtt_topic);
+    if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, (const char *)cbor_buf, len, 0, 0) == -1)
+        ESP_LOGI(TAG, "mqtt publish error occurred!");
+
+    return ESP_OK;
+}
+
+esp_err_t PublishMQTT(MQTT_user_t *mqtt_user, TaskModbus_t *data)
+{
     cJSON *jsDOC;
 
+    if (mqtt_user->formats & MQTT_FORMAT_CBOR)
+        PublishCBOR(mqtt_user, data);
+
+    if (!(mqtt_user->formats & MQTT_FORMAT_JSON))
+        return ESP_OK;
+
+    int64_t start = esp_timer_get_time();
+
     jsDOC = cJSON_CreateObject();
     if (jsDOC)
     {
@@ -56,11 +154,12 @@ esp_err_t PublishMQTT(MQTT_user_t *mqtt_user, TaskModbus_t *data)
         cJSON_AddItemToObject(jsDOC, "I_AC_PF", cJSON_CreateNumber(data->solaredge->I_AC_PF));
 
         cJSON_AddItemToObject(jsDOC, "I_AC_Energy_WH", cJSON_CreateNumber(data->solaredge->I_AC_Energy_WH));
-        cJSON_AddItemToObject(jsDOC, "I_AC_Energy_WH_24H", cJSON_CreateNumber(data->solaredge->I_AC_Energy_WH - data->solaredge->I_AC_Energy_WH_Last24H));
+        cJSON_AddItemToObject(jsDOC, "I_AC_Energy_WH_24H", cJSON_CreateNumber(SE_EnergyToday(data->solaredge)));
 
         cJSON_AddItemToObject(jsDOC, "I_DC_Current", cJSON_CreateNumber(data->solaredge->I_DC_Current));
         cJSON_AddItemToObject(jsDOC, "I_DC_Voltage", cJSON_CreateNumber(data->solaredge->I_DC_Voltage));
         cJSON_AddItemToObject(jsDOC, "I_DC_Power", cJSON_CreateNumber(data->solaredge->I_DC_Power));
+        cJSON_AddItemToObject(jsDOC, "I_DC_AC_Efficiency", cJSON_CreateNumber(data->solaredge->I_DC_AC_Efficiency));
 
         cJSON_AddItemToObject(jsDOC, "I_Temp_Sink", cJSON_CreateNumber(data->solaredge->I_Temp_Sink));
 
@@ -69,18 +168,12 @@ esp_err_t PublishMQTT(MQTT_user_t *mqtt_user, TaskModbus_t *data)
 
         char *strJSON = cJSON_Print(jsDOC);
 
+        mqtt_user->stats.json_us = esp_timer_get_time() - start;
+        mqtt_user->stats.json_bytes = strJSON ? strlen(strJSON) : 0;
+
         if (esp_mqtt_client_publish(mqtt_user->mqtt_client, mqtt_user->mqtt_topic, strJSON, 0, 0, 0) == -1)
             ESP_LOGI(TAG, "mqtt publish error occurred!");
 
-        for (size_t i = 0; i < sizeof(HA_CfgSensors) / sizeof(HA_CfgSensors[0]); i++)
-        {
-            cJSON *item = cJSON_GetObjectItem(jsDOC, HA_CfgSensors[i].Name);
-
-            snprintf(topic_buf, sizeof(topic_buf), "%s/%s/state", mqtt_user->mqtt_topic, HA_CfgSensors[i].UniqueId);
-            snprintf(message_buf, sizeof(message_buf), "%d", item->valueint);
-            esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, message_buf, 0, 0, 0);
-        }
-
         cJSON_Delete(jsDOC);
         jsDOC = nullptr;
 
@@ -92,36 +185,390 @@ esp_err_t PublishMQTT(MQTT_user_t *mqtt_user, TaskModbus_t *data)
     return ESP_FAIL;
 }
 
-esp_err_t HAConfigMessage(MQTT_user_t *mqtt_user)
+//
+// per field publishing: every channel on <topic>/<channel>, only when it left the deadband or the heartbeat expired.
+// The identity of the inverter does not change, it is published retained once per connection.
+//
+esp_err_t PublishFieldsMQTT(MQTT_user_t *mqtt_user, TaskModbus_t *data)
 {
-    char topicBuf[128];
-    char haTopic[128];
+    static int32_t lastStatus = -1;
+    static int32_t lastStatusVendor = -1;
 
-    for (size_t i = 0; i < sizeof(HA_CfgSensors) / sizeof(HA_CfgSensors[0]); i++)
+    char topic_buf[128], message_buf[32];
+
+    if (!mqtt_user->mqtt_client || !mqtt_user->deadband)
+        return ESP_FAIL;
+
+    SolarEdge_t *se = data->solaredge;
+    time_t now = (time_t)(se->Timestamp / 1000000LL);
+
+    if (mqtt_user->fields_stale)
     {
-        sprintf(topicBuf, "%s/%s/state", mqtt_user->mqtt_topic, HA_CfgSensors[i].UniqueId);
+        const struct
+        {
+            const char *Name;
+            const char *Value;
+        } identity[] = {
+            { "C_Manufacturer", (const char *)data->sunspec->C_Manufacturer },
+            { "C_Model", (const char *)data->sunspec->C_Model },
+            { "C_Version", (const char *)data->sunspec->C_Version },
+            { "C_SerialNumber", (const char *)data->sunspec->C_SerialNumber },
+        };
+
+        for (size_t i = 0; i < sizeof(identity) / sizeof(identity[0]); i++)
+        {
+            snprintf(topic_buf, sizeof(topic_buf), "%s/%s", mqtt_user->mqtt_topic, identity[i].Name);
+            esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, identity[i].Value, 0, 1, 1);
+        }
+
+        snprintf(topic_buf, sizeof(topic_buf), "%s/C_SunSpec_Phase", mqtt_user->mqtt_topic);
+        snprintf(message_buf, sizeof(message_buf), "%u", (unsigned)data->sunspec->C_SunSpec_Phase);
+        esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, message_buf, 0, 1, 1);
 
-        cJSON *jsConfig = cJSON_CreateObject();
+        mqtt_user->deadband->Invalidate();
+        lastStatus = -1;
+        lastStatusVendor = -1;
+        mqtt_user->fields_stale = false;
+    }
 
-        cJSON_AddItemToObject(jsConfig, "name", cJSON_CreateString(HA_CfgSensors[i].Name));
-        cJSON_AddItemToObject(jsConfig, "unique_id", cJSON_CreateString(HA_CfgSensors[i].UniqueId));
-        cJSON_AddItemToObject(jsConfig, "device_class", cJSON_CreateString(HA_CfgSensors[i].DeviceClass));
-        cJSON_AddItemToObject(jsConfig, "state_class", cJSON_CreateString(HA_CfgSensors[i].StateClass));
-        cJSON_AddItemToObject(jsConfig, "state_topic", cJSON_CreateString(topicBuf));
-        cJSON_AddItemToObject(jsConfig, "unit_of_measurement", cJSON_CreateString(HA_CfgSensors[i].Unit));
+    for (int ch = 0; ch != CH_MAX; ch++)
+    {
+        float value = SE_ChannelValue(se, (SEChannel_t)ch);
 
-        snprintf(haTopic, sizeof(haTopic), "%s/sensor/%s/config", mqtt_user->mqtt_ha_topic, HA_CfgSensors[i].UniqueId);
+        if (!mqtt_user->deadband->Check((SEChannel_t)ch, value, now))
+            continue;
 
-        char *strJson = cJSON_Print(jsConfig);
-        esp_mqtt_client_publish(mqtt_user->mqtt_client, haTopic, strJson, 0, 0, 0);
-        free(strJson);
+        snprintf(topic_buf, sizeof(topic_buf), "%s/%s", mqtt_user->mqtt_topic, SE_Channels[ch].Name);
+        snprintf(message_buf, sizeof(message_buf), "%.2f", value);
 
-        cJSON_Delete(jsConfig);
+        if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, message_buf, 0, 0, 0) == -1)
+            ESP_LOGI(TAG, "mqtt publish error occurred!");
+    }
+
+    // the status is an enumeration, published retained on every change
+    if (lastStatus != se->I_Status || lastStatusVendor != se->I_Status_Vendor)
+    {
+        lastStatus = se->I_Status;
+        lastStatusVendor = se->I_Status_Vendor;
+
+        snprintf(topic_buf, sizeof(topic_buf), "%s/I_Status", mqtt_user->mqtt_topic);
+        snprintf(message_buf, sizeof(message_buf), "%d", (int)se->I_Status);
+        esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, message_buf, 0, 1, 1);
+
+        snprintf(topic_buf, sizeof(topic_buf), "%s/I_Status_Vendor", mqtt_user->mqtt_topic);
+        snprintf(message_buf, sizeof(message_buf), "%d", (int)se->I_Status_Vendor);
+        esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, message_buf, 0, 1, 1);
     }
 
     return ESP_OK;
 }
 
+//
+// publish and empty the batch, on <topic>/batch
+//
+esp_err_t PublishBatchMQTT(MQTT_user_t *mqtt_user, SampleBatch *batch)
+{
+    static char batch_buf[BATCH_MAX_SIZE];
+    char topic_buf[128];
+
+    if (batch->GetCount() == 0)
+        return ESP_OK;
+
+    // without a client the samples are lost as well, they are counted and not serialized
+    if (!mqtt_user->mqtt_client)
+    {
+        batch->Reset();
+        mqtt_user->stats.batch_dropped++;
+        return ESP_FAIL;
+    }
+
+    size_t len = batch->Serialize(batch_buf, sizeof(batch_buf));
+    batch->Reset();
+
+    mqtt_user->stats.batch_bytes = len;
+
+    if (len == 0)
+    {
+        mqtt_user->stats.batch_dropped++;
+        ESP_LOGE(TAG, "batch does not fit in %d bytes", BATCH_MAX_SIZE);
+        return ESP_FAIL;
+    }
+
+    snprintf(topic_buf, sizeof(topic_buf), "%s/batch", mqtt_user->mqtt_topic);
+    if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, batch_buf, len, 0, 0) == -1)
+    {
+        mqtt_user->stats.batch_dropped++;
+        ESP_LOGI(TAG, "mqtt publish error occurred!");
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+//
+// retained description of the cbor document on <topic>/cbor/schema
+//
+esp_err_t PublishSchemaMQTT(MQTT_user_t *mqtt_user)
+{
+    char topic_buf[128];
+
+    if (!mqtt_user->mqtt_client)
+        return ESP_FAIL;
+
+    char *strSchema = TelemetrySchemaJSON();
+    if (!strSchema)
+        return ESP_ERR_NO_MEM;
+
+    snprintf(topic_buf, sizeof(topic_buf), "%s/cbor/schema", mqtt_user->mqtt_topic);
+    if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, strSchema, 0, 1, 1) == -1)
+        ESP_LOGI(TAG, "mqtt publish error occurred!");
+    free(strSchema);
+
+    return ESP_OK;
+}
+
+//
+// answer to a command on <topic>/cmd/ack. On success 'detail' is an optional json value, on failure the error message.
+//
+esp_err_t PublishAckMQTT(MQTT_user_t *mqtt_user, const Command_t *cmd, esp_err_t result, const char *detail)
+{
+    char topic_buf[128], message_buf[512];
+    TextWriter out(message_buf, sizeof(message_buf));
+
+    if (!mqtt_user->mqtt_client)
+        return ESP_FAIL;
+
+    // an unknown command is answered with the name that was asked for
+    out.Printf("{\"id\":%" PRIi32 ",\"cmd\":", cmd->Id);
+    out.String(cmd->Name[0] ? cmd->Name : CommandName(cmd->Type));
+    out.Printf(",\"status\":\"%s\"", result == ESP_OK ? "ok" : "error");
+
+    if (detail && result == ESP_OK)
+        out.Printf(",\"result\":%s", detail);
+    else if (detail)
+    {
+        out.Printf(",\"message\":");
+        out.String(detail);
+    }
+
+    out.Printf("}");
+
+    if (out.Overflow())
+        return ESP_FAIL;
+
+    snprintf(topic_buf, sizeof(topic_buf), "%s/" COMMAND_ACK_TOPIC, mqtt_user->mqtt_topic);
+    if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, message_buf, out.Length(), 1, 0) == -1)
+        ESP_LOGI(TAG, "mqtt publish error occurred!");
+
+    return ESP_OK;
+}
+
+//
+// summary of a closed statistics window, published on <topic>/stats
+//
+esp_err_t PublishStatsMQTT(MQTT_user_t *mqtt_user, Statistics *stats)
+{
+    static const struct
+    {
+        const char *Name;
+        float Quantile;
+    } quantiles[] = { { "p50", 0.50f }, { "p95", 0.95f }, { "p99", 0.99f } };
+
+    char topic_buf[128];
+
+    if (!mqtt_user->mqtt_client)
+        return ESP_FAIL;
+
+    cJSON *jsDOC = cJSON_CreateObject();
+    if (!jsDOC)
+        return ESP_FAIL;
+
+    cJSON_AddItemToObject(jsDOC, "window_start", cJSON_CreateNumber(stats->GetWindowStart()));
+    cJSON_AddItemToObject(jsDOC, "window", cJSON_CreateNumber(stats->GetWindow()));
+
+    for (uint8_t i = 0; i != stats->GetNumChannels(); i++)
+    {
+        TDigest *digest = stats->GetDigest(i);
+        cJSON *jsChannel = cJSON_CreateObject();
+
+        cJSON_AddItemToObject(jsChannel, "count", cJSON_CreateNumber(digest->Count()));
+
+        if (digest->Count())
+        {
+            cJSON_AddItemToObject(jsChannel, "min", cJSON_CreateNumber(digest->Min()));
+            cJSON_AddItemToObject(jsChannel, "mean", cJSON_CreateNumber(digest->Mean()));
+
+            for (size_t q = 0; q < sizeof(quantiles) / sizeof(quantiles[0]); q++)
+                cJSON_AddItemToObject(jsChannel, quantiles[q].Name, cJSON_CreateNumber(digest->Quantile(quantiles[q].Quantile)));
+
+            cJSON_AddItemToObject(jsChannel, "max", cJSON_CreateNumber(digest->Max()));
+        }
+
+        cJSON_AddItemToObject(jsDOC, SE_Channels[stats->GetChannel(i)].Name, jsChannel);
+    }
+
+    char *strJSON = cJSON_PrintUnformatted(jsDOC);
+
+    snprintf(topic_buf, sizeof(topic_buf), "%s/stats", mqtt_user->mqtt_topic);
+    if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, strJSON, 0, 1, 0) == -1)
+        ESP_LOGI(TAG, "mqtt publish error occurred!");
+
+    cJSON_Delete(jsDOC);
+    free(strJSON);
+
+    return ESP_OK;
+}
+
+//
+// alert transition: retained state on <topic>/alert/<name> and an event on <topic>/alert/event
+//
+esp_err_t PublishAlertMQTT(MQTT_user_t *mqtt_user, const AlertEvent_t *event)
+{
+    char topic_buf[128], message_buf[160];
+
+    if (!mqtt_user->mqtt_client)
+        return ESP_FAIL;
+
+    snprintf(topic_buf, sizeof(topic_buf), "%s/alert/%s", mqtt_user->mqtt_topic, event->Name);
+    esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, event->Active ? "ON" : "OFF", 0, 1, 1);
+
+    snprintf(topic_buf, sizeof(topic_buf), "%s/alert/event", mqtt_user->mqtt_topic);
+    snprintf(message_buf, sizeof(message_buf), "{\"alert\":\"%s\",\"state\":\"%s\",\"value\":%.2f,\"time\":%lld}", event->Name, event->Active ? "ON" : "OFF",
+        event->Value, (long long)(event->Timestamp / 1000000LL));
+
+    if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, message_buf, 0, 1, 0) == -1)
+        ESP_LOGI(TAG, "mqtt publish error occurred!");
+
+    return ESP_OK;
+}
+
+//
+// the retained state of every alert, after a (re)connect: a retained "ON" from before a reboot is cleared
+//
+esp_err_t PublishAlertStatesMQTT(MQTT_user_t *mqtt_user, const AlertEngine *alerts)
+{
+    char topic_buf[128];
+
+    if (!mqtt_user->mqtt_client)
+        return ESP_FAIL;
+
+    for (uint8_t i = 0; i != alerts->GetNumRules(); i++)
+    {
+        snprintf(topic_buf, sizeof(topic_buf), "%s/alert/%s", mqtt_user->mqtt_topic, alerts->GetName(i));
+        if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, alerts->IsActive(i) ? "ON" : "OFF", 0, 1, 1) == -1)
+            return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+//
+// home-assistant discovery for every sensor in HA_CfgSensors, retained on <ha-topic>/sensor/<serial>/<name>/config
+// with <serial>_<name> as unique id, so two gateways do not claim the same entities.
+// All sensors share the json document on <topic> as state topic and pick their value with a template.
+//
+esp_err_t PublishDiscoveryMQTT(MQTT_user_t *mqtt_user, TaskModbus_t *data)
+{
+    static char config_buf[768];
+    const char *sn = (const char *)data->sunspec->C_SerialNumber;
+    char topic_buf[160], serial[sizeof(data->sunspec->C_SerialNumber) + 1], object_id[32], unique_id[72];
+    size_t len = 0;
+
+    if (!mqtt_user->mqtt_client)
+        return ESP_FAIL;
+
+    if (!(mqtt_user->formats & MQTT_FORMAT_JSON))
+    {
+        ESP_LOGI(TAG, "no json document, home-assistant discovery skipped");
+        return ESP_OK;
+    }
+
+    // the serial number is padded with spaces, a topic level and an id only take [a-z0-9_-]
+    for (size_t i = 0; i != sizeof(data->sunspec->C_SerialNumber) && sn[i]; i++)
+    {
+        if (isalnum((unsigned char)sn[i]) || sn[i] == '-' || sn[i] == '_')
+            serial[len++] = tolower((unsigned char)sn[i]);
+    }
+    serial[len] = '\0';
+
+    if (len == 0)
+        return ESP_ERR_INVALID_STATE;
+
+    for (size_t i = 0; i < sizeof(HA_CfgSensors) / sizeof(HA_CfgSensors[0]); i++)
+    {
+        const HA_ConfigMsg_T *sensor = &HA_CfgSensors[i];
+        TextWriter out(config_buf, sizeof(config_buf));
+        size_t n;
+
+        for (n = 0; sensor->Name[n] && n < sizeof(object_id) - 1; n++)
+            object_id[n] = tolower((unsigned char)sensor->Name[n]);
+        object_id[n] = '\0';
+        snprintf(unique_id, sizeof(unique_id), "%s_%s", serial, object_id);
+
+        out.Printf("{\"name\":\"%s\",\"unique_id\":\"%s\"", sensor->Name, unique_id);
+        out.Printf(",\"state_topic\":\"%s\",\"value_template\":\"{{ value_json.%s }}\"", mqtt_user->mqtt_topic, sensor->Name);
+        out.Printf(",\"availability_topic\":\"%s/" MQTT_AVAILABILITY_TOPIC "\"", mqtt_user->mqtt_topic);
+
+        if (sensor->DeviceClass)
+            out.Printf(",\"device_class\":\"%s\"", sensor->DeviceClass);
+        if (sensor->StateClass)
+            out.Printf(",\"state_class\":\"%s\"", sensor->StateClass);
+        if (sensor->Unit)
+            out.Printf(",\"unit_of_measurement\":\"%s\"", sensor->Unit);
+
+        out.Printf(",\"device\":{\"identifiers\":[");
+        out.String((const char *)data->sunspec->C_SerialNumber);
+        out.Printf("],\"name\":");
+        out.String((const char *)data->sunspec->C_Model);
+        out.Printf(",\"manufacturer\":");
+        out.String((const char *)data->sunspec->C_Manufacturer);
+        out.Printf(",\"model\":");
+        out.String((const char *)data->sunspec->C_Model);
+        out.Printf(",\"sw_version\":");
+        out.String((const char *)data->sunspec->C_Version);
+        out.Printf("}}");
+
+        if (out.Overflow())
+        {
+            ESP_LOGE(TAG, "discovery of %s does not fit in %d bytes", sensor->Name, (int)sizeof(config_buf));
+            continue;
+        }
+
+        snprintf(topic_buf, sizeof(topic_buf), "%s/sensor/%s/%s/config", mqtt_user->mqtt_ha_topic, serial, object_id);
+        if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, config_buf, out.Length(), 1, 1) == -1)
+            ESP_LOGI(TAG, "mqtt publish error occurred!");
+
+        // an empty retained config removes the entity of older versions, announced without the serial number
+        snprintf(topic_buf, sizeof(topic_buf), "%s/sensor/%s/config", mqtt_user->mqtt_ha_topic, object_id);
+        if (esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, "", 0, 1, 1) == -1)
+            ESP_LOGI(TAG, "mqtt publish error occurred!");
+    }
+
+    return ESP_OK;
+}
+
+//
+// a command on <topic>/cmd is parsed here and queued, the main loop applies it between two samples
+//
+static void ReceiveCommand(MQTT_user_t *mqtt_user, esp_mqtt_event_handle_t event)
+{
+    char topic_buf[128];
+    Command_t cmd;
+
+    snprintf(topic_buf, sizeof(topic_buf), "%s/" COMMAND_TOPIC, mqtt_user->mqtt_topic);
+    if (event->topic_len != (int)strlen(topic_buf) || strncmp(event->topic, topic_buf, event->topic_len) != 0)
+        return;
+
+    // commands are small, a fragmented message is not a command
+    if (event->data_len != event->total_data_len)
+        return;
+
+    if (CommandParse(event->data, event->data_len, &cmd) != ESP_OK)
+        PublishAckMQTT(mqtt_user, &cmd, ESP_ERR_INVALID_ARG, cmd.Type == CMD_UNKNOWN ? "unknown command" : "invalid command");
+    else if (!mqtt_user->commands || xQueueSend(mqtt_user->commands, &cmd, 0) != pdTRUE)
+        PublishAckMQTT(mqtt_user, &cmd, ESP_ERR_NO_MEM, "busy");
+}
+
 void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_t event_id, void *event_data)
 {
     MQTT_user_t *mqtt_user = (MQTT_user_t *)handler_args;
@@ -129,8 +576,29 @@ void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_t event
     switch ((esp_mqtt_event_id_t)event_id)
     {
         case MQTT_EVENT_CONNECTED:
+        {
+            char topic_buf[128];
+
             ESP_LOGI(TAG, "HA Topic: %s", mqtt_user->mqtt_ha_topic);
-            HAConfigMessage(mqtt_user);
+
+            snprintf(topic_buf, sizeof(topic_buf), "%s/" MQTT_AVAILABILITY_TOPIC, mqtt_user->mqtt_topic);
+            esp_mqtt_client_publish(mqtt_user->mqtt_client, topic_buf, MQTT_ONLINE, 0, 1, 1);
+
+            snprintf(topic_buf, sizeof(topic_buf), "%s/" COMMAND_TOPIC, mqtt_user->mqtt_topic);
+            esp_mqtt_client_subscribe(mqtt_user->mqtt_client, topic_buf, 1);
+
+            // the discovery needs the identity of the inverter, it is published from the main loop
+            mqtt_user->discovery_pending = true;
+
+            // publish the identity and the current value of every field again, the broker may have lost them
+            mqtt_user->fields_stale = true;
+            mqtt_user->alerts_stale = true;
+            mqtt_user->schema_pending = true;
+            break;
+        }
+
+        case MQTT_EVENT_DATA:
+            ReceiveCommand(mqtt_user, (esp_mqtt_event_handle_t)event_data);
             break;
 
         default:
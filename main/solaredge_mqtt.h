@@ -2,24 +2,69 @@
 
 #include <esp_err.h>
 #include <mqtt_client.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 
 #include "private_types.h"
+#include "Statistics.h"
+#include "Alerts.h"
+#include "Deadband.h"
+#include "Batch.h"
+#include "Commands.h"
+
+// payload formats, selected with 'mqtt -o json,cbor,fields,batch'
+#define MQTT_FORMAT_JSON   (1 << 0) // json document on <topic>
+#define MQTT_FORMAT_CBOR   (1 << 1) // compact binary document on <topic>/cbor, schema on <topic>/cbor/schema
+#define MQTT_FORMAT_FIELDS (1 << 2) // one topic per channel <topic>/<channel>, published on change (deadband)
+#define MQTT_FORMAT_BATCH  (1 << 3) // all samples since the last publish, columnar json on <topic>/batch
+
+// availability for home-assistant: retained "online" on connect, "offline" as last will
+#define MQTT_AVAILABILITY_TOPIC "status"
+#define MQTT_ONLINE             "online"
+#define MQTT_OFFLINE            "offline"
+
+typedef struct
+{
+    size_t json_bytes;      // size of the last json document
+    int64_t json_us;        // time to build and serialize the last json document
+    size_t cbor_bytes;      // size of the last cbor document
+    int64_t cbor_us;        // time to encode the last cbor document
+    size_t batch_bytes;     // size of the last batch document
+    uint32_t batch_dropped; // batches lost: larger than BATCH_MAX_SIZE, no client or not published
+} MQTT_stats_t;
 
 typedef struct
 {
     const char *mqtt_ha_topic;
     const char *mqtt_topic;
     esp_mqtt_client_handle_t mqtt_client;
+    uint32_t formats;
+    MQTT_stats_t stats;
+    DeadbandFilter *deadband;   // per field publishing, only used with MQTT_FORMAT_FIELDS
+    volatile bool fields_stale; // set on (re)connect: publish the identity and all fields again
+    volatile bool discovery_pending; // set on (re)connect: publish the home-assistant discovery
+    volatile bool alerts_stale;      // set on (re)connect: publish the retained state of every alert
+    volatile bool schema_pending;    // set on (re)connect or when cbor is enabled: publish <topic>/cbor/schema
+    QueueHandle_t commands;          // Command_t received on <topic>/cmd, applied by the main loop
 } MQTT_user_t;
 
 typedef struct
 {
-    const char *Name;
-    const char *UniqueId;
-    const char *DeviceClass;
+    const char *Name;        // key in the json document, the unique id is the lower case name
+    const char *DeviceClass; // nullptr when home-assistant has no matching class
     const char *StateClass;
     const char *Unit;
 } HA_ConfigMsg_T;
 
+uint32_t MQTT_ParseFormats(const char *formats);
+void MQTT_FormatsString(uint32_t mask, char *buf, size_t size);
 esp_err_t PublishMQTT(MQTT_user_t *user, TaskModbus_t *data);
+esp_err_t PublishDiscoveryMQTT(MQTT_user_t *user, TaskModbus_t *data);
+esp_err_t PublishFieldsMQTT(MQTT_user_t *user, TaskModbus_t *data);
+esp_err_t PublishBatchMQTT(MQTT_user_t *user, SampleBatch *batch);
+esp_err_t PublishSchemaMQTT(MQTT_user_t *user);
+esp_err_t PublishAckMQTT(MQTT_user_t *user, const Command_t *cmd, esp_err_t result, const char *detail);
+esp_err_t PublishStatsMQTT(MQTT_user_t *user, Statistics *stats);
+esp_err_t PublishAlertMQTT(MQTT_user_t *user, const AlertEvent_t *event);
+esp_err_t PublishAlertStatesMQTT(MQTT_user_t *user, const AlertEngine *alerts);
 void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_t event_id, void *event_data);
@@ -65,10 +65,13 @@ typedef struct
  */
 typedef struct
 {
+    int64_t Timestamp; // capture time of the sample, microseconds since epoch
+
     uint8_t C_Manufacturer[32];
     uint8_t C_Model[32];
     uint8_t C_Version[16];
     uint8_t C_SerialNumber[32];
+    uint16_t C_SunSpec_Phase; // 101 = single phase, 102 = split phase, 103 = three phase
 
     float I_AC_Current;  // Total current
     float I_AC_CurrentA; // Phase A current
@@ -91,18 +94,16 @@ typedef struct
 
     float I_AC_Energy_WH;         // WattHours AC Lifetime Energy production
     float I_AC_Energy_WH_Last24H; // place holder to store the I_AC_Energy_WH for 'yesterday' to calculate daily production
+    float I_AC_Energy_WH_Frac;    // WattHours integrated from I_AC_Power, not yet visible in I_AC_Energy_WH
+    float I_AC_Energy_WH_Last24H_Frac; // I_AC_Energy_WH_Frac at midnight, kept apart: the sum does not fit a float
 
     float I_DC_Current; // Amps DC Current value
     float I_DC_Voltage; // Volts DC Voltage value
     float I_DC_Power;   // Watts DC Power value
 
+    float I_DC_AC_Efficiency; // % DC to AC conversion efficiency
+
     float I_Temp_Sink;        // Degrees C Heat Sink Temperature
     uint16_t I_Status;        // Operating state
     uint16_t I_Status_Vendor; // Vendor-defined operating state and error codes.
-
-    bool UpdatePower_24H; // flag to signal AVG_Power_24H has been updated, reset by GUI_UpdatePanels once used.
-    float AVG_Power_24H;  // scaling average over 6 minutes of values
-
-    bool UpdatePower_1H; // flag to signal AVG_Power_1H has been updated, reset by GUI_UpdatePanels once used.
-    float AVG_Power_1H;  // scaling average over 1 minutes of values
 } SolarEdge_t;
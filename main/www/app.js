@@ -0,0 +1,116 @@
+'use strict';
+
+// live values from ws://<gateway>/ws?format=json, history from /api/history
+
+const TILES = [
+  ['I_AC_Power', 'AC power', 'W', 0],
+  ['I_DC_Power', 'DC power', 'W', 0],
+  ['I_AC_Energy_WH_24H', 'Today', 'Wh', 0],
+  ['I_AC_VoltageAN', 'Voltage', 'V', 1],
+  ['I_AC_Frequency', 'Frequency', 'Hz', 2],
+  ['I_Temp_Sink', 'Heat sink', '°C', 1],
+];
+
+let range = 86400;
+let points = [];
+let unit = '';
+
+const $ = (id) => document.getElementById(id);
+
+function tiles() {
+  $('tiles').innerHTML = TILES.map(([key, label, u]) =>
+    `<div class="tile"><span>${label}</span><b id="v_${key}">-</b><span>${u}</span></div>`).join('');
+}
+
+function live() {
+  const ws = new WebSocket(`ws://${location.host}/ws?format=json`);
+
+  ws.onopen = () => { $('state').textContent = 'live'; };
+  ws.onclose = () => { $('state').textContent = 'reconnecting'; setTimeout(live, 5000); };
+  ws.onmessage = (ev) => {
+    const se = JSON.parse(ev.data);
+
+    for (const [key, , , digits] of TILES) {
+      if (key in se)
+        $('v_' + key).textContent = se[key].toFixed(digits);
+    }
+  };
+}
+
+async function channels() {
+  const info = await (await fetch('/api/history')).json();
+
+  $('channel').innerHTML = info.channels.map((c) => `<option value="${c.name}">${c.name} [${c.unit}]</option>`).join('');
+  $('channel').onchange = load;
+}
+
+async function load() {
+  const canvas = $('chart');
+  const to = Math.floor(Date.now() / 1000);
+  const width = Math.min(2000, Math.floor(canvas.clientWidth * devicePixelRatio));
+  const res = await fetch(`/api/history?ch=${$('channel').value}&from=${to - range}&to=${to}&width=${width}`);
+  const json = await res.json();
+
+  points = json.points;
+  unit = json.unit;
+  draw();
+}
+
+function draw() {
+  const canvas = $('chart');
+  const ctx = canvas.getContext('2d');
+  const w = (canvas.width = canvas.clientWidth * devicePixelRatio);
+  const h = (canvas.height = canvas.clientHeight * devicePixelRatio);
+  const to = Math.floor(Date.now() / 1000);
+  const from = to - range;
+
+  ctx.clearRect(0, 0, w, h);
+  if (!points.length)
+    return;
+
+  let lo = Infinity, hi = -Infinity;
+  for (const p of points) {
+    lo = Math.min(lo, p[1]);
+    hi = Math.max(hi, p[3]);
+  }
+  if (hi === lo)
+    hi = lo + 1;
+
+  const x = (t) => ((t - from) / range) * w;
+  const y = (v) => h - 20 - ((v - lo) / (hi - lo)) * (h - 40);
+
+  // min/max band
+  ctx.fillStyle = 'rgba(230, 100, 50, 0.25)';
+  ctx.beginPath();
+  points.forEach((p, i) => (i ? ctx.lineTo(x(p[0]), y(p[3])) : ctx.moveTo(x(p[0]), y(p[3]))));
+  for (let i = points.length - 1; i >= 0; i--)
+    ctx.lineTo(x(points[i][0]), y(points[i][1]));
+  ctx.fill();
+
+  // mean
+  ctx.strokeStyle = '#e63';
+  ctx.lineWidth = devicePixelRatio;
+  ctx.beginPath();
+  points.forEach((p, i) => (i ? ctx.lineTo(x(p[0]), y(p[2])) : ctx.moveTo(x(p[0]), y(p[2]))));
+  ctx.stroke();
+
+  ctx.fillStyle = '#888';
+  ctx.font = `${12 * devicePixelRatio}px sans-serif`;
+  ctx.fillText(`${hi.toFixed(1)} ${unit}`, 4, 14 * devicePixelRatio);
+  ctx.fillText(`${lo.toFixed(1)} ${unit}`, 4, h - 4);
+}
+
+document.querySelectorAll('nav button').forEach((b) => {
+  b.onclick = () => {
+    document.querySelectorAll('nav button').forEach((o) => o.classList.toggle('on', o === b));
+    range = +b.dataset.range;
+    load();
+  };
+});
+
+window.onresize = draw;
+
+tiles();
+live();
+channels().then(load);
+setInterval(load, 60000);
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+#
+# Convert the PNG images of the display into run length encoded RGB565, for embedding in flash.
+#
+# The PNG decoder only needs zlib: 8 bit RGB or RGBA, not interlaced. The images are LV_IMG_CF_TRUE_COLOR
+# on a black background (LV_COLOR_DEPTH 16, LV_COLOR_16_SWAP 0): RGBA is composited over black, the
+# colour premultiplied with its alpha, so semi-transparent edges do not show as light fringes.
+#
+# RLE: a control byte n, followed by
+#   n < 0x80:  n + 1 literal pixels
+#   n >= 0x80: one pixel, repeated (n & 0x7f) + 1 times
+# pixels are 2 bytes, little endian.
+#
+# Writes images.rle, all images one after the other, and image_assets.h with the table.
+#
+# usage: embed_images.py <output-dir> <png>...
+#
+
+import os
+import struct
+import sys
+import zlib
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def decode_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit('%s: not a PNG' % path)
+
+    pos, idat = 8, b''
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'IDAT':
+            idat += chunk
+
+    if depth != 8 or color not in (2, 6) or interlace:
+        sys.exit('%s: only 8 bit RGB or RGBA, not interlaced' % path)
+
+    bpp = 4 if color == 6 else 3
+    stride = width * bpp
+    raw = zlib.decompress(idat)
+    prev = bytearray(stride)
+    pixels = []
+
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif kind == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xff
+            elif kind == 4:
+                line[i] = (line[i] + paeth(a, b, c)) & 0xff
+
+        for x in range(width):
+            r, g, b = line[x * bpp:x * bpp + 3]
+            if bpp == 4:
+                a = line[x * bpp + 3]
+                r, g, b = r * a // 255, g * a // 255, b * a // 255
+            pixels.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+        prev = line
+
+    return width, height, pixels
+
+
+def rle(pixels):
+    out = bytearray()
+    i = 0
+
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+
+        if run >= 2:
+            out += struct.pack('<BH', 0x80 | (run - 1), pixels[i])
+            i += run
+            continue
+
+        # literals up to the next run of at least 3
+        start = i
+        while i < len(pixels) and i - start < 128:
+            if i + 2 < len(pixels) and pixels[i] == pixels[i + 1] == pixels[i + 2]:
+                break
+            i += 1
+        out += struct.pack('<B', i - start - 1)
+        out += struct.pack('<%dH' % (i - start), *pixels[start:i])
+
+    return bytes(out)
+
+
+def write(path, data):
+    # only touch the file when it changed, avoids relinking
+    if os.path.exists(path):
+        with open(path, 'rb') as f:
+            if f.read() == data:
+                return
+    with open(path, 'wb') as f:
+        f.write(data)
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('usage: embed_images.py <output-dir> <png>...')
+
+    out = sys.argv[1]
+    os.makedirs(out, exist_ok=True)
+
+    blob = b''
+    ids, table = [], []
+
+    for path in sys.argv[2:]:
+        name = os.path.splitext(os.path.basename(path))[0]
+        width, height, pixels = decode_png(path)
+        data = rle(pixels)
+
+        ids.append('#define IMG_%s %d\n' % (name.upper(), len(ids)))
+        table.append('        { %d, %d, %d, %d }, /* %s */ \\\n' % (width, height, len(blob), len(data), name))
+        blob += data
+
+    write(os.path.join(out, 'images.rle'), blob)
+
+    header = ('// generated by tools/embed_images.py, do not edit\n'
+              '#pragma once\n\n' + ''.join(ids) + '#define IMG_COUNT %d\n\n' % len(ids) +
+              '// width, height, offset and size in images.rle\n'
+              '#define IMG_TABLE \\\n    { \\\n' + ''.join(table) + '    }\n')
+    write(os.path.join(out, 'image_assets.h'), header.encode())
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+#
+# Gzip the web dashboard for embedding in flash.
+#
+# app.js is served as immutable, index.html refers to it with the hash of its content (@APP_HASH@),
+# so a new firmware is picked up by the browser without ever revalidating app.js.
+# Writes index.html.gz, app.js.gz and www_assets.h with the ETags.
+#
+# usage: embed_www.py <source-dir> <output-dir>
+#
+
+import gzip
+import hashlib
+import os
+import sys
+
+
+def compress(data):
+    # mtime=0: the same input gives the same output, and the same ETag
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def write(path, data):
+    # only touch the file when it changed, avoids relinking
+    if os.path.exists(path):
+        with open(path, 'rb') as f:
+            if f.read() == data:
+                return
+    with open(path, 'wb') as f:
+        f.write(data)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: embed_www.py <source-dir> <output-dir>')
+
+    src, out = sys.argv[1], sys.argv[2]
+    os.makedirs(out, exist_ok=True)
+
+    with open(os.path.join(src, 'app.js'), 'rb') as f:
+        app = f.read()
+    with open(os.path.join(src, 'index.html'), 'rb') as f:
+        index = f.read()
+
+    app_hash = hashlib.sha256(app).hexdigest()[:16]
+    index = index.replace(b'@APP_HASH@', app_hash.encode())
+    index_hash = hashlib.sha256(index).hexdigest()[:16]
+
+    app_gz = compress(app)
+    index_gz = compress(index)
+
+    write(os.path.join(out, 'app.js.gz'), app_gz)
+    write(os.path.join(out, 'index.html.gz'), index_gz)
+
+    header = ('// generated by tools/embed_www.py, do not edit\n'
+              '#pragma once\n\n'
+              '#define WWW_APP_ETAG   "\\"%s\\""\n'
+              '#define WWW_INDEX_ETAG "\\"%s\\""\n' % (app_hash, index_hash))
+    write(os.path.join(out, 'www_assets.h'), header.encode())
+
+    print('www: index.html %d -> %d bytes, app.js %d -> %d bytes' % (len(index), len(index_gz), len(app), len(app_gz)))
+
+
+if __name__ == '__main__':
+    main()